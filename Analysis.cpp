@@ -0,0 +1,104 @@
+#include "Analysis.hpp"
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace SimpleAI
+{
+namespace
+{
+// Score de chaque coup d'une position (recherche de la position après le coup)
+template <int Rows, int Cols>
+void analyzePosition(BasicNegamaxEngine<Rows, Cols>& engine, const BasicPosition<Rows, Cols>& pos,
+                     const SearchLimits& limits, PositionAnalysis& analysis)
+{
+    using Position = BasicPosition<Rows, Cols>;
+
+    analysis = PositionAnalysis();
+    std::fill(analysis.scores, analysis.scores + MAX_WIDTH, INVALID_MOVE_SCORE);
+    if (pos.nbMoves() >= Position::CELLS || pos.lastPlayerWon())
+        return;
+
+    SearchLimits moveLimits = limits;
+    moveLimits.maxDepth = std::max(1, limits.maxDepth - 1);
+    moveLimits.minDepth = std::min(limits.minDepth, moveLimits.maxDepth);
+
+    int bestScore = INVALID_MOVE_SCORE;
+    analysis.depth = 1;  // coups résolus sans recherche
+    for (int i = 0; i < Position::WIDTH; i++)
+    {
+        const int col = Position::CENTER_ORDER[i];
+        if (!pos.canPlay(col))
+            continue;
+
+        int score = 0;
+        if (pos.isWinningMove(col))
+            score = WIN_SCORE + (Position::CELLS - pos.nbMoves());
+        else if (pos.nbMoves() + 1 < Position::CELLS)
+        {
+            Position child = pos;
+            child.play(col);
+            const SearchResult result = engine.search(child, moveLimits);
+            score = -result.score;
+            analysis.nodes += result.nodes;
+            analysis.depth = std::max(analysis.depth, result.depth + 1);
+        }
+
+        analysis.scores[col] = score;
+        if (score > bestScore)
+        {
+            bestScore = score;
+            analysis.bestMove = col;
+        }
+    }
+}
+}
+
+template <int Rows, int Cols>
+void analyzeBatch(const BasicPosition<Rows, Cols>* positions, size_t count, const SearchLimits& limits,
+                  PositionAnalysis* results, int threads, TranspositionTable* tt, WorkerPool* pool)
+{
+    using Engine = BasicNegamaxEngine<Rows, Cols>;
+
+    // Chaque thread prend la position suivante dès qu'il a fini la sienne
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        Engine engine(tt);
+        for (size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1))
+            analyzePosition(engine, positions[i], limits, results[i]);
+    };
+
+    // Pas plus de threads que de positions
+    threads = std::max(1, threads);
+    if (static_cast<size_t>(threads) > count)
+        threads = static_cast<int>(std::max<size_t>(1, count));
+
+    std::vector<std::thread> helpers;
+    std::vector<std::future<void>> pooled;
+    for (int i = 1; i < threads; i++)
+    {
+        if (pool)
+            pooled.push_back(pool->submit(worker));
+        else
+            helpers.emplace_back(worker);
+    }
+
+    worker();
+
+    for (std::thread& t : helpers)
+        t.join();
+    for (std::future<void>& f : pooled)
+        f.wait();
+}
+
+// ---------------------------------------------------------
+// Grilles gérées : 7 x 6 (standard), 8 x 7, 9 x 7
+// ---------------------------------------------------------
+template void analyzeBatch(const BasicPosition<6, 7>*, size_t, const SearchLimits&, PositionAnalysis*, int,
+                           TranspositionTable*, WorkerPool*);
+template void analyzeBatch(const BasicPosition<7, 8>*, size_t, const SearchLimits&, PositionAnalysis*, int,
+                           TranspositionTable*, WorkerPool*);
+template void analyzeBatch(const BasicPosition<7, 9>*, size_t, const SearchLimits&, PositionAnalysis*, int,
+                           TranspositionTable*, WorkerPool*);
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "TranspositionTable.hpp"
+#include "WorkerPool.hpp"
+
+namespace SimpleAI
+{
+// Score d'une colonne injouable (pleine ou hors de la grille)
+constexpr int INVALID_MOVE_SCORE = -INF_SCORE;
+
+// Analyse d'une position : score de chaque coup du point de vue du joueur au trait
+struct PositionAnalysis
+{
+    int scores[MAX_WIDTH];   // INVALID_MOVE_SCORE pour une colonne injouable
+    int bestMove = -1;       // -1 si la grille est pleine ou la partie finie
+    int depth = 0;           // profondeur atteinte (coup le plus approfondi, coup joué compris)
+    uint64_t nodes = 0;
+};
+
+// =============================================================
+//   ANALYSE DE PLUSIEURS POSITIONS
+// =============================================================
+// Revue d'une partie, indices, validation de parties enregistrées :
+// chaque coup jouable de chaque position est cherché (victoire immédiate
+// et grille pleine sans recherche), limits s'appliquant à chaque coup
+// (maxDepth compté depuis la position analysée).
+// Les positions sont réparties dynamiquement entre threads threads (le thread
+// appelant plus threads - 1 pris dans pool, créés pour l'analyse à défaut),
+// un moteur par thread, tous sur la même table de transposition (optionnelle).
+// results doit contenir count éléments.
+template <int Rows, int Cols>
+void analyzeBatch(const BasicPosition<Rows, Cols>* positions, size_t count, const SearchLimits& limits,
+                  PositionAnalysis* results, int threads = 1, TranspositionTable* tt = nullptr,
+                  WorkerPool* pool = nullptr);
+}
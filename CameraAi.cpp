@@ -114,6 +114,15 @@ void CameraAI::stop()
     qDebug() << "[AI] 🛑 Capture arrêtée";
 }
 
+void CameraAI::setGridSize(int rows, int cols)
+{
+    QMutexLocker lock(&gridMutex_);
+    rows_ = rows;
+    cols_ = cols;
+    grid_ = Grid(rows_, QVector<int>(cols_, 0));
+    gridComplete_ = false;
+}
+
 int CameraAI::getGrille(Grid& out) const
 {
     QMutexLocker lock(&gridMutex_);
@@ -383,7 +392,15 @@ std::vector<Detection> CameraAI::inferTorch(const cv::Mat& frameBGR)
 
 void CameraAI::updateGrid(const std::vector<Detection>& dets)
 {
-    if ((int)dets.size() != rows_ * cols_) {
+    // Taille de la grille lue une fois par image (setGridSize() est appelée depuis le thread GUI)
+    int rows, cols;
+    {
+        QMutexLocker lock(&gridMutex_);
+        rows = rows_;
+        cols = cols_;
+    }
+
+    if ((int)dets.size() != rows * cols) {
         // Grille incomplète - démarrer le timer si pas déjà démarré
         if (!incompleteTimerStarted_) {
             incompleteTimerStarted_ = true;
@@ -429,26 +446,26 @@ void CameraAI::updateGrid(const std::vector<Detection>& dets)
     std::sort(cells.begin(), cells.end(),
               [](auto& a, auto& b) { return a.cy < b.cy; });
 
-    Grid newGrid(rows_, QVector<int>(cols_, 0));
+    Grid newGrid(rows, QVector<int>(cols, 0));
     bool ok = true;
 
-    for (int r = 0; r < rows_; ++r) {
-        int start = r * cols_;
-        int end = start + cols_;
+    for (int r = 0; r < rows; ++r) {
+        int start = r * cols;
+        int end = start + cols;
 
         if (end > (int)cells.size()) { ok = false; break; }
 
         std::sort(cells.begin() + start, cells.begin() + end,
                   [](auto& a, auto& b) { return a.cx < b.cx; });
 
-        for (int c = 0; c < cols_; ++c)
+        for (int c = 0; c < cols; ++c)
             newGrid[r][c] = cells[start + c].val;
     }
 
     // Validation : un pion ne peut pas flotter dans l'air
     // Il doit avoir un support en dessous (ou être sur la ligne du bas)
-    for (int r = 0; r < rows_ - 1; ++r) {  // Pas besoin de vérifier la dernière ligne
-        for (int c = 0; c < cols_; ++c) {
+    for (int r = 0; r < rows - 1; ++r) {  // Pas besoin de vérifier la dernière ligne
+        for (int c = 0; c < cols; ++c) {
             // Si c'est un pion (rouge=1 ou jaune=2)
             if (newGrid[r][c] != 0) {
                 // Vérifier qu'il y a un support en dessous (ligne r+1)
@@ -34,13 +34,16 @@ public:
     void start(int camIndex = 0);
     void stop();
 
+    // Taille de la grille à détecter en lignes, colonnes (7 x 6 par défaut, colonnes x lignes)
+    void setGridSize(int rows, int cols);
+
     // Retourne la grille détectée
     int getGrille(Grid& out) const;
 
 signals:
     void frameReady(const QImage& img);
     void gridUpdated(const Grid& g);
-    void gridIncomplete(int detectedCount);  // Émis quand la grille n'est pas complète (pas 42 pions)
+    void gridIncomplete(int detectedCount);  // Émis quand la grille n'est pas complète (pas rows x cols cases)
     void gridComplete();  // Émis quand la grille devient complète
 
 private slots:
@@ -58,10 +61,9 @@ private:
     bool               running = false;
     std::shared_ptr<torch::jit::Module> model;
 
-    static constexpr int rows_ = 6;
-    static constexpr int cols_ = 7;
-
     mutable QMutex     gridMutex_;
+    int                rows_ = 6;      // protégés par gridMutex_
+    int                cols_ = 7;
     Grid               grid_;          // ← Grille utilisant le type Grid
     bool               gridComplete_ = false;
     int                incompleteCount_ = 0;  // Compteur de détections incomplètes consécutives
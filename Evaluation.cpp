@@ -0,0 +1,98 @@
+#include "Evaluation.hpp"
+#include <initializer_list>
+
+namespace SimpleAI
+{
+namespace
+{
+// Masques propres à chaque taille de grille, calculés à la compilation
+template <class Position>
+struct EvalMasks
+{
+    using Bitboard = typename Position::Bitboard;
+
+    // Lignes 1, 3, 5... (en comptant depuis 1 en bas)
+    static constexpr Bitboard ODD_ROWS = [] {
+        Bitboard b = 0;
+        for (int col = 0; col < Position::WIDTH; col++)
+            for (int row = 0; row < Position::HEIGHT; row += 2)
+                b |= Position::cellMask(row, col);
+        return b;
+    }();
+
+    static constexpr Bitboard CENTER = Position::columnMask(Position::WIDTH / 2);
+};
+
+// ---------------------------------------------------------
+// Deux ouverts d'un joueur : fenêtres de 4 cases (repérées par leur
+// première case) contenant exactement 2 de ses pions et aucun pion adverse.
+// Toutes les fenêtres (69 en 7 x 6) sont traitées en parallèle, une direction à la fois.
+// ---------------------------------------------------------
+template <class Position, class Bitboard = typename Position::Bitboard>
+inline int openTwos(Bitboard stones, Bitboard free)
+{
+    int count = 0;
+    for (int s : {1, Position::HEIGHT + 1, Position::HEIGHT, Position::HEIGHT + 2})
+    {
+        // Fenêtres sans pion adverse (les sentinelles, hors de free, éliminent celles qui débordent)
+        const Bitboard open = free & (free >> s) & (free >> 2 * s) & (free >> 3 * s);
+
+        // Additionneur bit à bit des 4 cases de chaque fenêtre
+        const Bitboard a = stones, b = stones >> s, c = stones >> 2 * s, d = stones >> 3 * s;
+        const Bitboard sum1 = a ^ b, carry1 = a & b;
+        const Bitboard sum2 = c ^ d, carry2 = c & d;
+        const Bitboard exactlyTwo = (sum1 & sum2)
+                                  | (carry1 & ~sum2 & ~carry2)
+                                  | (carry2 & ~sum1 & ~carry1);
+
+        count += popcount(open & exactlyTwo);
+    }
+    return count;
+}
+
+// ---------------------------------------------------------
+// Menaces d'un joueur : cases vides qui lui donneraient 4 alignés
+// ---------------------------------------------------------
+template <class Position, class Bitboard = typename Position::Bitboard>
+inline int threatScore(Bitboard stones, Bitboard empty, Bitboard goodRows)
+{
+    const Bitboard threats = Position::winningCells(stones) & empty;
+    return EVAL_THREAT * popcount(threats & ~goodRows)
+         + EVAL_GOOD_THREAT * popcount(threats & goodRows);
+}
+}
+
+// ---------------------------------------------------------
+// Évaluation heuristique
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+int evaluate(const BasicPosition<Rows, Cols>& pos)
+{
+    using Position = BasicPosition<Rows, Cols>;
+    using Bitboard = typename Position::Bitboard;
+    using Masks = EvalMasks<Position>;
+
+    const Bitboard me = pos.current();
+    const Bitboard opp = pos.opponent();
+    const Bitboard empty = ~pos.mask() & Position::BOARD_MASK;
+
+    // Le joueur qui a commencé est au trait quand le nombre de pions est pair
+    const bool meFirst = (pos.nbMoves() % 2) == 0;
+    const Bitboard myRows = meFirst ? Masks::ODD_ROWS : (Position::BOARD_MASK & ~Masks::ODD_ROWS);
+    const Bitboard oppRows = Position::BOARD_MASK & ~myRows;
+
+    int score = threatScore<Position>(me, empty, myRows) - threatScore<Position>(opp, empty, oppRows);
+
+    score += EVAL_TWO * (openTwos<Position>(me, Position::BOARD_MASK & ~opp)
+                       - openTwos<Position>(opp, Position::BOARD_MASK & ~me));
+
+    score += EVAL_CENTER * (popcount(me & Masks::CENTER) - popcount(opp & Masks::CENTER));
+
+    return score;
+}
+
+// Grilles gérées : 7 x 6 (standard), 8 x 7, 9 x 7
+template int evaluate(const BasicPosition<6, 7>&);
+template int evaluate(const BasicPosition<7, 8>&);
+template int evaluate(const BasicPosition<7, 9>&);
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// Poids de l'évaluation heuristique
+constexpr int EVAL_TWO = 2;            // fenêtre de 4 avec 2 pions et 2 cases vides
+constexpr int EVAL_THREAT = 8;         // case vide qui compléterait un alignement (trois ouvert)
+constexpr int EVAL_GOOD_THREAT = 16;   // menace sur une ligne de bonne parité pour son joueur
+constexpr int EVAL_CENTER = 3;         // pion dans la colonne centrale
+
+// Évaluation statique d'une position non terminale, du point de vue du joueur au trait.
+// Compte les menaces (trois ouverts) en tenant compte de la parité des lignes
+// (le premier joueur profite des menaces sur les lignes impaires, le second sur les paires),
+// les deux ouverts des fenêtres de 4 cases (69 en 7 x 6) et les pions au centre.
+// Entièrement calculée par masques et décalages de bitboards, sans boucle sur les cases.
+// Toujours strictement inférieure à WIN_SCORE en valeur absolue.
+// Instanciée dans Evaluation.cpp pour les grilles 7 x 6, 8 x 7 et 9 x 7.
+template <int Rows, int Cols>
+int evaluate(const BasicPosition<Rows, Cols>& pos);
+}
@@ -1,9 +1,14 @@
 #include "GameLogic.hpp"
 #include "Negamax.hpp"      // → version SimpleAI que nous venons de créer
+#include "TorchNetwork.hpp"
 #include <vector>
 #include <cstdlib>          // Pour rand()
 #include <ctime>            // Pour srand()
 #include <QRandomGenerator> // Pour génération aléatoire améliorée
+#include <QCoreApplication>
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
 using namespace SimpleAI;
 
 // =============================================================
@@ -23,19 +28,47 @@ GameLogic::GameLogic(CameraAI* cam,
     // Initialiser le générateur de nombres aléatoires pour le mode facile
     srand(time(nullptr));
 
-    grid.resize(6);
-    prevGrid.resize(6);
-    candidateGrid.resize(6);
-    referenceGrid.resize(6);
-    stableCandidate.resize(6);
-    for (int r = 0; r < 6; r++) {
-        grid[r].resize(7);
-        prevGrid[r].resize(7);
-        candidateGrid[r].resize(7);
-        referenceGrid[r].resize(7);
-        stableCandidate[r].resize(7);
+    // Recherche du robot sur tous les cœurs disponibles (Lazy SMP)
+    SimpleAI::setSearchThreads(QThread::idealThreadCount());
+
+    // Moteur de chaque difficulté (Negamax si le fichier est absent) et taille de la table de transposition
+    loadEngineConfig("./engine.json");
+    SimpleAI::setTranspositionTableSize(TranspositionTable::entriesForMegabytes(transpositionTableMb));
+    qDebug() << "[GameLogic] Table de transposition :" << transpositionTableMb << "Mo ("
+             << SimpleAI::transpositionTable().size() << "éléments)";
+
+    // Bibliothèque d'ouvertures (générée hors ligne par book_generator), projetée en mémoire
+    QString bookPath = QCoreApplication::applicationDirPath() + "/Model/opening_book.bin";
+    if (SimpleAI::loadOpeningBook(bookPath.toStdString())) {
+        qDebug() << "[GameLogic] Bibliothèque d'ouvertures chargée :" << SimpleAI::openingBook().size()
+                 << "positions jusqu'à" << SimpleAI::openingBook().maxPly() << "pions";
+    } else {
+        qWarning() << "[GameLogic] ⚠️ Bibliothèque d'ouvertures introuvable :" << bookPath;
+    }
+
+    // Cache des positions déjà cherchées, conservé d'une partie (et d'un lancement) à l'autre
+    QString cachePath = QCoreApplication::applicationDirPath() + "/Model/position_cache.bin";
+    if (SimpleAI::loadPositionCache(cachePath.toStdString())) {
+        qDebug() << "[GameLogic] Cache des positions chargé :" << SimpleAI::positionCache().size() << "positions";
+    } else {
+        qWarning() << "[GameLogic] ⚠️ Cache des positions inutilisable :" << cachePath;
     }
 
+    // Réseau valeur / politique du moteur (facultatif), à côté du modèle de la caméra :
+    // sa politique trie les coups près de la racine de chaque recherche
+    QString networkPath = QCoreApplication::applicationDirPath() + "/Model/connect4_net.torchscript";
+    auto network = std::make_shared<SimpleAI::TorchNetwork>();
+    std::string networkError;
+    if (network->load(networkPath.toStdString(), &networkError)) {
+        SimpleAI::setNeuralNetwork(network);
+        qDebug() << "[GameLogic] Réseau valeur / politique chargé :" << networkPath;
+    } else {
+        qWarning() << "[GameLogic] ⚠️ Réseau valeur / politique indisponible :" << networkPath
+                   << QString::fromStdString(networkError).left(200);
+    }
+
+    resizeGrids();
+
     // Frame vers view
     connect(camera, &CameraAI::frameReady,
             this, &GameLogic::sendFrameToScreen,
@@ -45,6 +78,11 @@ GameLogic::GameLogic(CameraAI* cam,
     connect(camera, &CameraAI::gridUpdated,
             this, &GameLogic::onGridUpdated,
             Qt::QueuedConnection);
+
+    // Indices du joueur (émis depuis le thread d'analyse) vers la view
+    connect(&hintEngine, &HintEngine::hintsUpdated,
+            this, &GameLogic::hintsUpdated,
+            Qt::QueuedConnection);
 }
 
 GameLogic::~GameLogic()
@@ -70,6 +108,19 @@ void GameLogic::prepareGame()
     robotColor = sm->getRobotColorValue();    // Inverse du joueur
     qDebug() << "[GameLogic] Couleur joueur:" << playerColor << "- Couleur robot:" << robotColor;
 
+    // Taille de la grille : la recherche spécialisée est choisie une seule fois ici
+    boardRows = sm->getBoardRows();
+    boardCols = sm->getBoardCols();
+    if (!SimpleAI::setBoardSize(boardRows, boardCols)) {
+        qWarning() << "[GameLogic] ⚠️ Grille" << boardCols << "x" << boardRows << "non gérée, grille standard 7 x 6";
+        boardRows = 6;
+        boardCols = 7;
+        SimpleAI::setBoardSize(boardRows, boardCols);
+    }
+    camera->setGridSize(boardRows, boardCols);
+    resizeGrids();
+    qDebug() << "[GameLogic] Grille :" << boardCols << "colonnes x" << boardRows << "lignes";
+
     // Démarrer la caméra IMMÉDIATEMENT pour qu'elle ait le temps de se stabiliser
     // pendant la connexion du robot et le compte à rebours
     qDebug() << "[GameLogic] Démarrage anticipé de la caméra...";
@@ -92,8 +143,8 @@ void GameLogic::prepareGame()
         }
         preparationRunning = true;
 
-        // Lancer la préparation dans un thread séparé pour ne pas bloquer l'UI
-        std::thread([this]() {
+        // Lancer la préparation sur un thread du robot pour ne pas bloquer l'UI
+        robotWorkers.submit([this]() {
             qDebug() << "[GameLogic] Thread de préparation démarré";
 
             // Connexion au robot
@@ -177,7 +228,7 @@ void GameLogic::prepareGame()
             QMetaObject::invokeMethod(this, [this]() { emit robotInitialized(); }, Qt::QueuedConnection);
 
             qDebug() << "[GameLogic] Thread de préparation terminé";
-        }).detach();
+        });
     } else {
         qDebug() << "[GameLogic] Robot déjà connecté, pas de Home() nécessaire";
         // Émettre robotInitialized immédiatement car on n'affiche pas l'overlay
@@ -201,6 +252,8 @@ void GameLogic::startGame()
     // Le joueur commence
     currentTurn = PlayerTurn;
     emit turnPlayer();
+    startPondering();
+    startHints();
     qDebug() << "[GameLogic] === PARTIE PRÊTE ===";
 }
 
@@ -214,6 +267,8 @@ void GameLogic::stopGame()
     negamaxRunning = false;
     preparationRunning = false;
 
+    SimpleAI::stopPondering();
+    hintEngine.stop();
     camera->stop();
 
     // Réinitialiser tous les compteurs et états
@@ -229,21 +284,25 @@ void GameLogic::stopGame()
     // Le thread de Home() de CalibrationLogic s'arrêtera automatiquement
     // via disconnectToRobot() plus bas
 
-    // Attendre proprement la fin du thread du robot
-    if (negamaxThreadObj) {
-        // Si le thread est en cours d'exécution, attendre qu'il se termine
-        if (negamaxThreadObj->isRunning()) {
-            qDebug() << "[GameLogic] Attente de la fin du thread robot...";
-            negamaxThreadObj->quit();
-            // Attendre maximum 5 secondes pour que le thread se termine proprement
-            if (!negamaxThreadObj->wait(5000)) {
-                qWarning() << "[GameLogic] Le thread du robot n'a pas pu se terminer proprement, terminaison forcée";
-                negamaxThreadObj->terminate();
-                negamaxThreadObj->wait();
-            }
+    // Annuler la recherche en cours : le moteur rend la main en quelques millisecondes
+    searchCancel = true;
+
+    // Attendre proprement la fin du tour du robot
+    if (robotTurn.valid()) {
+        qDebug() << "[GameLogic] Attente de la fin du tour robot...";
+        // Recherche annulée : seule une commande robot en cours peut encore le retenir,
+        // le flag d'arrêt d'urgence l'interrompt
+        if (robotTurn.wait_for(std::chrono::milliseconds(500)) != std::future_status::ready) {
+            qDebug() << "[GameLogic] Commande robot en cours, interruption...";
+            if (robot)
+                robot->emergencyStopFlag = true;
+            // Attente bornée : une commande robot bloquée ne doit pas figer l'interface.
+            // Le thread reste au groupe et la tâche se terminera seule, negamaxRunning
+            // (déjà à false) empêche tout nouveau tour d'ici là
+            if (robotTurn.wait_for(std::chrono::seconds(2)) != std::future_status::ready)
+                qWarning() << "[GameLogic] Le tour robot ne s'est pas terminé en 2s, abandon";
         }
-        delete negamaxThreadObj;
-        negamaxThreadObj = nullptr;
+        robotTurn = std::future<void>();
     }
 
     // CRITIQUE : Activer le flag d'arrêt d'urgence du robot pour interrompre
@@ -295,6 +354,8 @@ void GameLogic::emergencyStopGame()
     negamaxRunning = false;
     preparationRunning = false;
 
+    SimpleAI::stopPondering();
+    hintEngine.stop();
     camera->stop();
 
     // Réinitialiser tous les compteurs et états
@@ -307,25 +368,22 @@ void GameLogic::emergencyStopGame()
     currentTurn = PlayerTurn;
     lastRobotColumn = -1;
 
-    // Attendre proprement la fin du thread du robot (timeout court : 2 secondes max)
-    if (negamaxThreadObj) {
-        if (negamaxThreadObj->isRunning()) {
-            qDebug() << "[GameLogic] Attente de la fin du thread robot (timeout 2s)...";
-            negamaxThreadObj->quit();
+    // Annuler la recherche en cours : le moteur rend la main en quelques millisecondes
+    searchCancel = true;
 
-            // Timeout court car le thread devrait se terminer rapidement grâce au flag emergencyStopFlag
-            if (!negamaxThreadObj->wait(2000)) {
-                qWarning() << "[GameLogic] Le thread robot ne s'est pas terminé en 2s, abandon (fuite mémoire)";
-                negamaxThreadObj = nullptr;  // Perdre la référence, le thread finira tout seul
-            } else {
-                qDebug() << "[GameLogic] Thread robot terminé proprement";
-                delete negamaxThreadObj;
-                negamaxThreadObj = nullptr;
-            }
+    // Attendre proprement la fin du tour du robot (timeout court : 2 secondes max)
+    if (robotTurn.valid()) {
+        qDebug() << "[GameLogic] Attente de la fin du tour robot (timeout 2s)...";
+
+        // Timeout court : recherche annulée et commandes robot interrompues par emergencyStopFlag
+        if (robotTurn.wait_for(std::chrono::seconds(2)) != std::future_status::ready) {
+            // Le thread reste au groupe : la tâche se terminera seule, negamaxRunning (déjà à false)
+            // empêche tout nouveau tour d'ici là
+            qWarning() << "[GameLogic] Le tour robot ne s'est pas terminé en 2s, abandon";
         } else {
-            delete negamaxThreadObj;
-            negamaxThreadObj = nullptr;
+            qDebug() << "[GameLogic] Tour robot terminé proprement";
         }
+        robotTurn = std::future<void>();
     }
 
     // NE PAS déconnecter le robot ici - c'est déjà fait par MainWindow::emergencyDisconnect()
@@ -426,9 +484,11 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
         int newPiecesCount = 0;
         int newPlayerPieces = 0;
         int newRobotPieces = 0;
+        int newRow = -1;
+        int newCol = -1;
 
-        for (int r = 0; r < 6; r++) {
-            for (int c = 0; c < 7; c++) {
+        for (int r = 0; r < boardRows; r++) {
+            for (int c = 0; c < boardCols; c++) {
                 // Un pion a disparu (case remplie -> case vide)
                 if (referenceGrid[r][c] != 0 && g[r][c] == 0) {
                     camera->stop();
@@ -446,6 +506,8 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
                 // Un nouveau pion est apparu (case vide -> case remplie)
                 else if (referenceGrid[r][c] == 0 && g[r][c] != 0) {
                     newPiecesCount++;
+                    newRow = r;
+                    newCol = c;
                     if (g[r][c] == playerColor)
                         newPlayerPieces++;
                     else if (g[r][c] == robotColor)
@@ -489,8 +551,9 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
         referenceGrid = g;
         grid = g;
 
-        // Vérifier la victoire et l'égalité
-        if (checkWin(playerColor)) {
+        // Vérifier la victoire et l'égalité : seul le pion qui vient d'être posé peut compléter un alignement
+        const bool won = checkWin(newRow, newCol);
+        if (won && grid[newRow][newCol] == playerColor) {
             camera->stop();
             QString diffString;
             switch (sm->getDifficulty()) {
@@ -503,7 +566,7 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
             return;
         }
 
-        if (checkWin(robotColor)) {
+        if (won && grid[newRow][newCol] == robotColor) {
             camera->stop();
             QString diffString;
             switch (sm->getDifficulty()) {
@@ -537,6 +600,8 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
 
             if (detectPlayerMove(prevGrid, grid, playedCol)) {
                 qDebug() << "[GameLogic] ✅ Coup joueur validé dans colonne" << playedCol;
+                SimpleAI::stopPondering();
+                hintEngine.stop();  // le coup du joueur est joué : ses indices sont périmés
                 currentTurn = RobotTurn;
                 emit turnRobot();
                 launchRobotTurn();
@@ -548,6 +613,8 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
                 // Forcer le passage au tour du robot malgré l'échec de détection
                 // Car on sait qu'un pion a été ajouté (vérifié en phase 3)
                 qDebug() << "[GameLogic] Passage forcé au tour du robot";
+                SimpleAI::stopPondering();
+                hintEngine.stop();  // le coup du joueur est joué : ses indices sont périmés
                 currentTurn = RobotTurn;
                 emit turnRobot();
                 launchRobotTurn();
@@ -556,6 +623,8 @@ void GameLogic::onGridUpdated(const QVector<QVector<int>>& g)
             qDebug() << "[GameLogic] ✅ Coup robot validé, passage au tour du joueur";
             currentTurn = PlayerTurn;
             emit turnPlayer();
+            startPondering();
+            startHints();
         }
     }
 }
@@ -571,8 +640,8 @@ bool GameLogic::detectPlayerMove(const QVector<QVector<int>>& oldG,
 
     // Afficher les grilles pour debug
     QString oldGridStr = "\n[GRILLE PRÉCÉDENTE]\n";
-    for (int r = 0; r < 6; r++) {
-        for (int c = 0; c < 7; c++) {
+    for (int r = 0; r < boardRows; r++) {
+        for (int c = 0; c < boardCols; c++) {
             oldGridStr += QString::number(oldG[r][c]) + " ";
         }
         oldGridStr += "\n";
@@ -580,16 +649,16 @@ bool GameLogic::detectPlayerMove(const QVector<QVector<int>>& oldG,
     qDebug().noquote() << oldGridStr;
 
     QString newGridStr = "\n[GRILLE ACTUELLE]\n";
-    for (int r = 0; r < 6; r++) {
-        for (int c = 0; c < 7; c++) {
+    for (int r = 0; r < boardRows; r++) {
+        for (int c = 0; c < boardCols; c++) {
             newGridStr += QString::number(newG[r][c]) + " ";
         }
         newGridStr += "\n";
     }
     qDebug().noquote() << newGridStr;
 
-    for (int r = 0; r < 6; r++) {
-        for (int c = 0; c < 7; c++) {
+    for (int r = 0; r < boardRows; r++) {
+        for (int c = 0; c < boardCols; c++) {
             // Détecter un nouveau pion de la couleur du joueur
             if (oldG[r][c] == 0 && newG[r][c] == playerColor) {
                 playedColumn = c;
@@ -610,7 +679,7 @@ bool GameLogic::detectRobotPlacement(const QVector<QVector<int>>& oldG,
                                      const QVector<QVector<int>>& newG,
                                      int robotColumn)
 {
-    for (int r = 0; r < 6; r++) {
+    for (int r = 0; r < boardRows; r++) {
         if (oldG[r][robotColumn] == 0 && newG[r][robotColumn] == robotColor)
             return true;
     }
@@ -629,21 +698,138 @@ void GameLogic::launchRobotTurn()
         return;
     }
 
-    int depth = 5;
+    int timeBudgetMs = 0;
+    int maxDepth = 0;
+    searchBudget(timeBudgetMs, maxDepth);
+
+    qDebug() << "[GameLogic] Lancement du thread negamax avec budget=" << timeBudgetMs << "ms, profondeur max=" << maxDepth;
+    runNegamax(timeBudgetMs, maxDepth);
+}
+
+// =============================================================
+//   BUDGET DE RÉFLEXION
+// =============================================================
+void GameLogic::searchBudget(int& timeBudgetMs, int& maxDepth) const
+{
+    // Budget de réflexion par difficulté : latence du tour prévisible quelle que soit la position
+    timeBudgetMs = 300;
+    maxDepth = 6;
     switch (sm->getDifficulty()) {
-    case StateMachine::Easy: depth = 3; break;
-    case StateMachine::Medium: depth = 5; break;
-    case StateMachine::Hard: depth = 6; break;
+    case StateMachine::Easy: timeBudgetMs = 100; maxDepth = 3; break;
+    case StateMachine::Medium: timeBudgetMs = 300; maxDepth = 6; break;
+    case StateMachine::Hard: timeBudgetMs = 1500; maxDepth = boardRows * boardCols; break;
+    }
+}
+
+// =============================================================
+//   MOTEUR PAR DIFFICULTÉ
+// =============================================================
+void GameLogic::setDifficultyEngine(StateMachine::Difficulty difficulty, SimpleAI::SearchMode mode)
+{
+    difficultyEngines[difficulty] = mode;
+}
+
+void GameLogic::loadEngineConfig(const QString& path)
+{
+    QFile f(path);
+    if (!f.open(QIODevice::ReadOnly)) {
+        qDebug() << "[GameLogic] Pas de réglages du moteur :" << path << "(Negamax pour toutes les difficultés, table de" << DEFAULT_TT_MB << "Mo)";
+        return;
+    }
+
+    QJsonDocument doc = QJsonDocument::fromJson(f.readAll());
+    f.close();
+    if (!doc.isObject()) {
+        qWarning() << "[GameLogic] ❌ Réglages du moteur invalides (format JSON incorrect) :" << path;
+        return;
     }
 
-    qDebug() << "[GameLogic] Lancement du thread negamax avec profondeur=" << depth;
-    runNegamax(depth);
+    const QJsonObject root = doc.object();
+    const QJsonObject engines = root["engines"].toObject();
+    // Facile joue toujours au hasard : aucun moteur à choisir
+    if (engines.contains("easy"))
+        qWarning() << "[GameLogic] ⚠️ Moteur de la difficulté Facile ignoré : elle joue toujours au hasard";
+
+    const struct { const char* key; StateMachine::Difficulty difficulty; } difficulties[] = {
+        {"medium", StateMachine::Medium}, {"hard", StateMachine::Hard}
+    };
+    for (const auto& d : difficulties) {
+        if (!engines.contains(d.key))
+            continue;
+        const QString name = engines[d.key].toString().toLower();
+        if (name == "negamax")
+            setDifficultyEngine(d.difficulty, SimpleAI::SearchMode::Negamax);
+        else if (name == "mcts")
+            setDifficultyEngine(d.difficulty, SimpleAI::SearchMode::Mcts);
+        else if (name == "solver")
+            setDifficultyEngine(d.difficulty, SimpleAI::SearchMode::Solver);
+        else
+            qWarning() << "[GameLogic] ⚠️ Moteur inconnu pour" << d.key << ":" << name << "(Negamax conservé)";
+    }
+
+    if (root.contains("transposition_table_mb")) {
+        const int mb = root["transposition_table_mb"].toInt(DEFAULT_TT_MB);
+        if (mb > 0)
+            transpositionTableMb = mb;
+        else
+            qWarning() << "[GameLogic] ⚠️ Taille de table de transposition invalide :" << mb << "Mo";
+    }
+    qDebug() << "[GameLogic] Réglages du moteur chargés depuis" << path;
+}
+
+SimpleAI::SearchMode GameLogic::searchMode() const
+{
+    return difficultyEngines[sm->getDifficulty()];
+}
+
+// =============================================================
+//   RÉFLEXION PENDANT LE TOUR DU JOUEUR
+// =============================================================
+void GameLogic::startPondering()
+{
+    // Mode facile : coup aléatoire, rien à préparer
+    if (!gameRunning || sm->getDifficulty() == StateMachine::Easy)
+        return;
+
+    int timeBudgetMs = 0;
+    int maxDepth = 0;
+    searchBudget(timeBudgetMs, maxDepth);
+
+    SimpleAI::SearchLimits budget;
+    budget.maxDepth = maxDepth;
+    SimpleAI::SearchMode mode = searchMode();
+
+    qDebug() << "[GameLogic] Réflexion pendant le tour du joueur (profondeur max" << maxDepth << ")";
+    SimpleAI::startPondering(grid, budget, robotColor, mode);
+}
+
+// =============================================================
+//   INDICES DU JOUEUR
+// =============================================================
+void GameLogic::setHintsEnabled(bool enabled)
+{
+    hintsEnabled = enabled;
+    qDebug() << "[GameLogic] Indices" << (enabled ? "activés" : "désactivés");
+
+    if (!enabled)
+        hintEngine.stop();
+    else if (currentTurn == PlayerTurn)
+        startHints();
+}
+
+void GameLogic::startHints()
+{
+    if (!hintsEnabled || !gameRunning)
+        return;
+
+    // Même moteur et même table que le robot, thread de basse priorité
+    hintEngine.start(grid, playerColor, HINT_MAX_DEPTH);
 }
 
 // =============================================================
 //   THREAD : IA SimpleAI
 // =============================================================
-void GameLogic::runNegamax(int depth)
+void GameLogic::runNegamax(int timeBudgetMs, int maxDepth)
 {
     qDebug() << "[GameLogic] runNegamax() - negamaxRunning=" << negamaxRunning;
 
@@ -652,8 +838,9 @@ void GameLogic::runNegamax(int depth)
         return;
     }
     negamaxRunning = true;
+    searchCancel = false;
 
-    negamaxThreadObj = QThread::create([this, depth]() {
+    robotTurn = robotWorkers.submit([this, timeBudgetMs, maxDepth]() {
 
         qDebug() << "[GameLogic] Thread robot démarré";
 
@@ -666,11 +853,11 @@ void GameLogic::runNegamax(int depth)
         // IA : déterminer la meilleure colonne pour le robot
         int bestMove = -1;
 
-        // Fonction helper pour vérifier si une colonne est pleine (6 lignes)
+        // Fonction helper pour vérifier si une colonne est pleine
         auto isColumnFull = [this](int col) -> bool {
-            if (col < 0 || col >= 7) return true;  // Colonne invalide = pleine
-            // Une colonne est pleine si toutes les 6 lignes sont remplies (non-zéro)
-            for (int row = 0; row < 6; row++) {
+            if (col < 0 || col >= boardCols) return true;  // Colonne invalide = pleine
+            // Une colonne est pleine si toutes ses lignes sont remplies (non-zéro)
+            for (int row = 0; row < boardRows; row++) {
                 if (grid[row][col] == 0) return false;  // Case vide trouvée
             }
             return true;  // Toutes les cases sont remplies
@@ -678,7 +865,7 @@ void GameLogic::runNegamax(int depth)
 
         // Obtenir la liste des colonnes valides (non pleines)
         QVector<int> validColumns;
-        for (int col = 0; col < 7; col++) {
+        for (int col = 0; col < boardCols; col++) {
             if (!isColumnFull(col)) {
                 validColumns.append(col);
             }
@@ -702,12 +889,51 @@ void GameLogic::runNegamax(int depth)
             bestMove = validColumns[randomIndex];
             qDebug() << "[GameLogic] *** MODE FACILE *** Colonne aléatoire choisie :" << bestMove << "(index" << randomIndex << "sur" << validColumns.size() << "colonnes)";
         } else {
-            // Modes Normal et Difficile : utiliser Negamax
-            qDebug() << "[GameLogic] IA réfléchit avec Negamax...";
+            // Modes Normal et Difficile : moteur choisi pour la difficulté
+            qDebug() << "[GameLogic] IA réfléchit (moteur" << static_cast<int>(searchMode()) << ")...";
             emit robotStatus("Il réfléchit");
             QVector<QVector<int>> current = grid;
-            bestMove = SimpleAI::getBestMove(current, depth, robotColor);
-            qDebug() << "[GameLogic] Negamax a choisi la colonne" << bestMove;
+            SimpleAI::SearchLimits budget;
+            budget.time = std::chrono::milliseconds(timeBudgetMs);
+            budget.maxDepth = maxDepth;
+            budget.stop = &searchCancel;
+            // Moteur de la difficulté : Negamax par défaut, Monte-Carlo ou solveur exact
+            // si engine.json le demande (loadEngineConfig)
+            const SimpleAI::SearchMode mode = searchMode();
+            SimpleAI::SearchStats stats;
+            SimpleAI::SearchResult result = SimpleAI::getBestMoveTimed(current, budget, robotColor, mode, &stats);
+            bestMove = result.move;
+            qDebug() << "[GameLogic] IA a choisi la colonne" << bestMove
+                     << "(profondeur" << result.depth << "," << result.nodes << "positions, score" << result.score << ")";
+
+            QString pv;
+            for (int i = 0; i < stats.pvLength; i++)
+                pv += QString::number(stats.pv[i] + 1);
+            QString iterations;
+            for (int i = 0; i < stats.iterationCount; i++)
+                iterations += QString(" %1:%2ms").arg(stats.iterations[i].depth)
+                                  .arg(stats.iterations[i].time.count() / 1000.0, 0, 'f', 1);
+            qDebug().noquote() << "[GameLogic] Statistiques : source" << static_cast<int>(stats.source)
+                               << "| temps" << stats.time.count() / 1000.0 << "ms"
+                               << "| coupures" << stats.betaCutoffs << "(1er coup" << stats.cutoffsAtMove[0] << ")"
+                               << "| table" << stats.ttHits << "/" << stats.ttProbes
+                               << "| variante" << pv << "| itérations" << iterations;
+            emit searchStats(stats);
+
+            const TranspositionTable& tt = SimpleAI::transpositionTable();
+            qDebug() << "[GameLogic] Table de transposition :" << tt.size() << "éléments,"
+                     << tt.probes() << "sondages," << tt.hits() << "succès,"
+                     << tt.collisions() << "collisions";
+
+            const SimpleAI::PositionCache& cache = SimpleAI::positionCache();
+            int ply = 0;  // pions dans la grille, quelle que soit sa taille
+            for (const QVector<int>& row : current)
+                ply += static_cast<int>(row.size() - row.count(0));
+            // Statistiques par pion limitées à la grille standard (seule à utiliser le cache)
+            if (ply <= SimpleAI::Position::CELLS)
+                qDebug() << "[GameLogic] Cache des positions :" << cache.size() << "éléments, à" << ply << "pions"
+                         << cache.hits(ply) << "/" << cache.probes(ply) << "succès ("
+                         << qRound(100.0 * cache.hitRate(ply)) << "%)";
 
             // Vérifier que Negamax n'a pas choisi une colonne pleine (sécurité)
             if (isColumnFull(bestMove)) {
@@ -801,8 +1027,8 @@ void GameLogic::runNegamax(int depth)
         qDebug() << "[GameLogic] Lancement du repositionnement au réservoir" << (isLeftReservoir ? "gauche" : "droit");
         emit robotStatus(QString("Se repositionne au réservoir %1").arg(isLeftReservoir ? "gauche" : "droit"));
 
-        // Lancer le repositionnement dans un thread séparé (asynchrone)
-        QThread* repositionThread = QThread::create([this, isLeftReservoir, reservoirsEmpty]() {
+        // Lancer le repositionnement sur l'autre thread du robot (asynchrone)
+        robotWorkers.submit([this, isLeftReservoir, reservoirsEmpty]() {
             qDebug() << "[GameLogic] Thread de repositionnement démarré";
 
             if (isLeftReservoir) {
@@ -822,75 +1048,36 @@ void GameLogic::runNegamax(int depth)
             }
         });
 
-        connect(repositionThread, &QThread::finished, repositionThread, &QThread::deleteLater);
-        repositionThread->start();
-
         // currentTurn reste à RobotTurn - onGridUpdated() va le changer à PlayerTurn après validation
     });
 
-    negamaxThreadObj->start();
-    qDebug() << "[GameLogic] Thread robot lancé";
+    qDebug() << "[GameLogic] Tour robot soumis";
 }
 
 // =============================================================
 //   DÉTECTION DE VICTOIRE - 4 PIONS ALIGNÉS
 // =============================================================
-bool GameLogic::checkWin(int color)
+bool GameLogic::checkWin(int row, int col)
 {
-    // Vérifier horizontal (4 alignés horizontalement)
-    for (int r = 0; r < 6; r++) {
-        for (int c = 0; c <= 3; c++) {  // 7 - 4 = 3
-            if (grid[r][c] == color &&
-                grid[r][c+1] == color &&
-                grid[r][c+2] == color &&
-                grid[r][c+3] == color) {
-                return true;
-            }
-        }
-    }
-
-    // Vérifier vertical (4 alignés verticalement)
-    for (int r = 0; r <= 2; r++) {  // 6 - 4 = 2
-        for (int c = 0; c < 7; c++) {
-            if (grid[r][c] == color &&
-                grid[r+1][c] == color &&
-                grid[r+2][c] == color &&
-                grid[r+3][c] == color) {
-                return true;
-            }
-        }
-    }
-
-    // Vérifier diagonal descendant (\)
-    for (int r = 0; r <= 2; r++) {
-        for (int c = 0; c <= 3; c++) {
-            if (grid[r][c] == color &&
-                grid[r+1][c+1] == color &&
-                grid[r+2][c+2] == color &&
-                grid[r+3][c+3] == color) {
-                return true;
-            }
-        }
-    }
+    // Fenêtres de 4 cases passant par le dernier pion posé (table précalculée du moteur)
+    return SimpleAI::isWinningMoveAt(grid, row, col);
+}
 
-    // Vérifier diagonal montant (/)
-    for (int r = 3; r < 6; r++) {
-        for (int c = 0; c <= 3; c++) {
-            if (grid[r][c] == color &&
-                grid[r-1][c+1] == color &&
-                grid[r-2][c+2] == color &&
-                grid[r-3][c+3] == color) {
-                return true;
-            }
-        }
+// =============================================================
+//   DIMENSIONS DES GRILLES
+// =============================================================
+void GameLogic::resizeGrids()
+{
+    for (QVector<QVector<int>>* g : {&grid, &prevGrid, &candidateGrid, &referenceGrid, &stableCandidate}) {
+        g->resize(boardRows);
+        for (int r = 0; r < boardRows; r++)
+            (*g)[r].resize(boardCols);
     }
-
-    return false;
 }
 
 bool GameLogic::isBoardFull()
 {
-    for (int c = 0; c < 7; c++)
+    for (int c = 0; c < boardCols; c++)
         if (grid[0][c] == 0)
             return false;
     return true;
@@ -5,11 +5,17 @@
 #include <QThread>
 #include <QMutex>
 #include <atomic>
+#include <future>
 
 #include "CameraAi.hpp"
 #include "Robot.hpp"
 #include "StateMachine.hpp"
 #include "CalibrationLogic.hpp"
+#include "Negamax.hpp"
+#include "HintEngine.hpp"
+#include "WorkerPool.hpp"
+
+Q_DECLARE_METATYPE(SimpleAI::SearchStats)
 
 // Forward declaration de GameScreen (view)
 class GameScreen;
@@ -27,6 +33,15 @@ public:
 
     ~GameLogic();
 
+    // Moteur du robot pour une difficulté (Facile joue toujours au hasard)
+    void setDifficultyEngine(StateMachine::Difficulty difficulty, SimpleAI::SearchMode mode);
+
+    // Réglages du moteur (fichier JSON, facultatif) : moteur des difficultés Normal et Difficile
+    // et taille de la table de transposition du robot en Mo
+    //   { "engines": { "medium": "mcts", "hard": "solver" },
+    //     "transposition_table_mb": 256 }
+    void loadEngineConfig(const QString& path);
+
 public slots:
     void prepareGame();        // avant le countdown - connexion robot et home
     void startGame();          // après countdownFinished() - démarrage caméra et jeu
@@ -35,12 +50,15 @@ public slots:
     void onGridUpdated(const QVector<QVector<int>>& g);
     void onReservoirsRefilled(); // Appelé quand l'utilisateur a rempli les réservoirs
     void resetRobotConnection(); // Réinitialise l'état de connexion du robot
+    void setHintsEnabled(bool enabled); // Indices du joueur activés / désactivés depuis GameScreen
 
 signals:
     // Vers GameScreen
     void turnPlayer();
     void turnRobot();
     void robotStatus(QString status);  // État détaillé du robot
+    void searchStats(SimpleAI::SearchStats stats);  // Statistiques de la recherche du coup du robot
+    void hintsUpdated(SimpleAI::PositionAnalysis analysis);  // Score de chaque colonne pour le joueur
     void difficultyText(QString);
     void sendFrameToScreen(QImage img);
     void endOfGame(QString winnerText, int totalSeconds);
@@ -62,6 +80,10 @@ private:
     CalibrationLogic* calib;
     StateMachine* sm;
 
+    // Taille de la grille (lue dans StateMachine au début de chaque partie)
+    int boardRows = 6;
+    int boardCols = 7;
+
     QVector<QVector<int>> grid;           // grille actuelle
     QVector<QVector<int>> prevGrid;       // grille précédente
     QVector<QVector<int>> candidateGrid;  // grille candidate à valider
@@ -80,9 +102,10 @@ private:
     bool robotConnected = false;          // robot connecté et prêt
     int elapsedSeconds = 0;               // récupéré depuis GameScreen
 
-    // Thread pour SimpleAI
-    QThread* negamaxThreadObj = nullptr;
+    // Tour du robot (recherche + mouvement), exécuté par robotWorkers
+    std::future<void> robotTurn;
     std::atomic<bool> negamaxRunning = false;
+    std::atomic<bool> searchCancel = false;  // Jeton d'arrêt de la recherche (arrêt de partie, changement d'écran)
 
     // Flag pour la préparation du robot (géré par CalibrationLogic::homeRobot())
     std::atomic<bool> preparationRunning = false;
@@ -97,6 +120,21 @@ private:
     int playerColor = 1;                  // Couleur choisie par le joueur
     int robotColor = 2;                   // Couleur du robot (inverse du joueur)
 
+    // Indices du joueur (activés depuis GameScreen), calculés pendant son tour
+    bool hintsEnabled = false;
+    HintEngine hintEngine;
+    static constexpr int HINT_MAX_DEPTH = 20;
+
+    // Moteur par difficulté (indexé par StateMachine::Difficulty) : Negamax partout par défaut,
+    // Monte-Carlo ou solveur exact choisis dans engine.json (loadEngineConfig)
+    SimpleAI::SearchMode difficultyEngines[3] = {
+        SimpleAI::SearchMode::Negamax, SimpleAI::SearchMode::Negamax, SimpleAI::SearchMode::Negamax
+    };
+
+    // Table de transposition du robot, allouée au démarrage (engine.json peut la changer)
+    static constexpr int DEFAULT_TT_MB = 64;
+    int transpositionTableMb = DEFAULT_TT_MB;
+
 private:
     bool detectPlayerMove(const QVector<QVector<int>>& oldG,
                           const QVector<QVector<int>>& newG,
@@ -107,14 +145,24 @@ private:
                               int robotColumn);
 
     void launchRobotTurn();
-    void runNegamax(int depth);
+    void runNegamax(int timeBudgetMs, int maxDepth);
+    void searchBudget(int& timeBudgetMs, int& maxDepth) const;  // Budget de réflexion selon la difficulté
+    SimpleAI::SearchMode searchMode() const;                     // Moteur de la difficulté courante
+    void startPondering();                                       // Réflexion pendant le tour du joueur
+    void startHints();                                           // Indices du joueur (si activés)
 
-    bool checkWin(int color);          // Vérifier si une couleur a gagné (4 alignés)
+    bool checkWin(int row, int col);   // Le pion posé en (row, col) aligne-t-il 4 pions de sa couleur ?
     bool isBoardFull();
+    void resizeGrids();                // Grilles de travail aux dimensions boardRows x boardCols
 
     // Gestion des réservoirs de pions
     CalibPoint getNextReservoirPosition();
 
     // Comparaison de grilles
     bool areGridsEqual(const QVector<QVector<int>>& g1, const QVector<QVector<int>>& g2);
+
+    // Threads permanents du robot (tour de jeu, repositionnement, préparation) : créés une seule
+    // fois avec GameLogic, aucune création de thread pendant un tour.
+    // Déclaré en dernier pour être détruit en premier (les tâches en cours utilisent les autres membres)
+    SimpleAI::WorkerPool robotWorkers{2};
 };
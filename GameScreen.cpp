@@ -2,6 +2,8 @@
 #include <QPixmap>
 #include <QFont>
 #include <QPalette>
+#include <QShortcut>
+#include "Negamax.hpp"
 
 GameScreen::GameScreen(QWidget *parent)
     : QWidget(parent)
@@ -139,6 +141,43 @@ void GameScreen::createGameWidget()
     countdownLabel->setStyleSheet("font-size: 120px; font-weight: bold; color: #1B3B5F;");
     countdownLabel->hide();
 
+    // ============================
+    //   OVERLAY DE DEBUG (statistiques de recherche)
+    // ============================
+    // Affiché dans le coin de l'image caméra, F12 pour l'afficher / le cacher
+    searchStatsLabel = new QLabel(cameraLabel);
+    searchStatsLabel->setStyleSheet(
+        "background-color: rgba(0, 0, 0, 170); color: #E0E0E0;"
+        " font-family: monospace; font-size: 14px; padding: 8px; border-radius: 6px;");
+    searchStatsLabel->move(10, 10);
+#ifdef NDEBUG
+    searchStatsLabel->hide();
+#endif
+
+    auto *statsShortcut = new QShortcut(QKeySequence(Qt::Key_F12), this);
+    connect(statsShortcut, &QShortcut::activated, this, [this]() {
+        searchStatsLabel->setVisible(!searchStatsLabel->isVisible());
+        searchStatsLabel->raise();
+    });
+
+    // ============================
+    //   INDICES DU JOUEUR (score de chaque colonne)
+    // ============================
+    // Affichés en bas de l'image caméra pendant le tour du joueur, H pour les activer / désactiver
+    hintsLabel = new QLabel(cameraLabel);
+    hintsLabel->setStyleSheet(
+        "background-color: rgba(0, 0, 0, 170); color: #E0E0E0;"
+        " font-family: monospace; font-size: 16px; padding: 8px; border-radius: 6px;");
+    hintsLabel->hide();
+
+    auto *hintsShortcut = new QShortcut(QKeySequence(Qt::Key_H), this);
+    connect(hintsShortcut, &QShortcut::activated, this, [this]() {
+        hintsEnabled = !hintsEnabled;
+        hintsLabel->clear();
+        hintsLabel->hide();
+        emit hintModeChanged(hintsEnabled);
+    });
+
     // ============================
     //   OVERLAY MESSAGE D'AVERTISSEMENT
     // ============================
@@ -522,6 +561,11 @@ void GameScreen::resetGame()
     titleLabel->setText("Partie en mode ");
     turnLabel->setText("");
     cameraLabel->clear();
+    searchStatsLabel->clear();
+    searchStatsLabel->adjustSize();
+    hintsLabel->clear();
+    hintsLabel->hide();
+    playerTurn = false;
 
     // S'assurer que le gameWidget est visible
     gameWidget->show();
@@ -663,6 +707,7 @@ void GameScreen::setTurnPlayer()
     QString color = (playerColor == 1) ? "#B22222" : "#EFCB00";
     turnLabel->setText("Au tour du joueur");
     turnLabel->setStyleSheet(QString("font-size: 35px; font-weight: bold; color: %1;").arg(color));
+    playerTurn = true;
 }
 
 void GameScreen::setTurnRobot()
@@ -671,6 +716,10 @@ void GameScreen::setTurnRobot()
     QString color = (playerColor == 1) ? "#EFCB00" : "#B22222";
     turnLabel->setText("Au tour du robot");
     turnLabel->setStyleSheet(QString("font-size: 35px; font-weight: bold; color: %1;").arg(color));
+
+    // Les indices ne valent que pour le tour du joueur
+    playerTurn = false;
+    hintsLabel->hide();
 }
 
 void GameScreen::setRobotStatus(const QString &status)
@@ -681,6 +730,91 @@ void GameScreen::setRobotStatus(const QString &status)
     turnLabel->setStyleSheet(QString("font-size: 35px; font-weight: bold; color: %1;").arg(color));
 }
 
+void GameScreen::setSearchStats(const SimpleAI::SearchStats &stats)
+{
+    static const char *sources[] = {"recherche", "bibliothèque", "cache", "réflexion anticipée", "solveur", "coup forcé",
+                                    "Monte-Carlo"};
+
+    const double ms = stats.time.count() / 1000.0;
+    const double nps = stats.time.count() > 0 ? stats.nodes * 1e6 / stats.time.count() : 0.0;
+
+    QString pv;
+    for (int i = 0; i < stats.pvLength; i++)
+        pv += QString::number(stats.pv[i] + 1);
+
+    // Part des coupures obtenues dès le premier coup essayé : qualité du tri des coups
+    QString firstCut = "-";
+    if (stats.betaCutoffs > 0)
+        firstCut = QString("%1 %").arg(100.0 * stats.cutoffsAtMove[0] / stats.betaCutoffs, 0, 'f', 1);
+
+    QString ttHits = "-";
+    if (stats.ttProbes > 0)
+        ttHits = QString("%1 %").arg(100.0 * stats.ttHits / stats.ttProbes, 0, 'f', 1);
+
+    QString iterations;
+    for (int i = 0; i < stats.iterationCount; i++)
+        iterations += QString(" %1:%2").arg(stats.iterations[i].depth)
+                          .arg(stats.iterations[i].time.count() / 1000.0, 0, 'f', 1);
+
+    QString text = QString("Source : %1\n"
+                           "Temps : %2 ms   Profondeur : %3\n"
+                           "Positions : %4 (%5 k/s)\n"
+                           "Coupures : %6 (1er coup %7)\n"
+                           "Table : %8 / %9 (%10)\n"
+                           "Variante : %11")
+                       .arg(sources[static_cast<int>(stats.source)])
+                       .arg(ms, 0, 'f', 1)
+                       .arg(stats.depth)
+                       .arg(stats.nodes)
+                       .arg(nps / 1000.0, 0, 'f', 0)
+                       .arg(stats.betaCutoffs)
+                       .arg(firstCut)
+                       .arg(stats.ttHits)
+                       .arg(stats.ttProbes)
+                       .arg(ttHits)
+                       .arg(pv.isEmpty() ? "-" : pv);
+    if (!iterations.isEmpty())
+        text += "\nItérations (ms) :" + iterations;
+
+    searchStatsLabel->setText(text);
+    searchStatsLabel->adjustSize();
+    searchStatsLabel->raise();
+}
+
+void GameScreen::setHints(const SimpleAI::PositionAnalysis &analysis)
+{
+    // Analyse arrivée après la fin du tour du joueur (ou indices désactivés entre-temps) : ignorée
+    if (!hintsEnabled || !playerTurn)
+        return;
+
+    // G : coup gagnant, P : coup perdant, - : colonne pleine, sinon score heuristique
+    QString columns = "Colonne ";
+    QString scores = "Score   ";
+    for (int col = 0; col < SimpleAI::boardCols(); col++) {
+        const int score = analysis.scores[col];
+        QString value;
+        if (score == SimpleAI::INVALID_MOVE_SCORE)
+            value = "-";
+        else if (score >= SimpleAI::WIN_SCORE)
+            value = "G";
+        else if (score <= -SimpleAI::WIN_SCORE)
+            value = "P";
+        else
+            value = QString("%1%2").arg(score > 0 ? "+" : "").arg(score);
+        if (col == analysis.bestMove)
+            value += "*";
+
+        columns += QString("%1").arg(col + 1, 5);
+        scores += QString("%1").arg(value, 5);
+    }
+
+    hintsLabel->setText(QString("Indices (profondeur %1)\n%2\n%3").arg(analysis.depth).arg(columns, scores));
+    hintsLabel->adjustSize();
+    hintsLabel->move(10, cameraLabel->height() - hintsLabel->height() - 10);
+    hintsLabel->show();
+    hintsLabel->raise();
+}
+
 void GameScreen::setDifficultyText(const QString &txt)
 {
     titleLabel->setText(QString("Partie en mode %1").arg(txt));
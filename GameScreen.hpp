@@ -10,6 +10,9 @@
 #include <QStackedWidget>
 #include <QMovie>
 
+#include "Analysis.hpp"
+#include "NegamaxEngine.hpp"
+
 class GameScreen : public QWidget
 {
     Q_OBJECT
@@ -27,6 +30,8 @@ public slots:
     void setTurnPlayer();
     void setTurnRobot();
     void setRobotStatus(const QString &status);
+    void setSearchStats(const SimpleAI::SearchStats &stats);  // Overlay de debug (F12)
+    void setHints(const SimpleAI::PositionAnalysis &analysis); // Indices du joueur (touche H)
     void setDifficultyText(const QString &txt);
     void showEndOfGame(const QString &winnerText, int totalSeconds);
     void showGridIncompleteWarning(int detectedCount);
@@ -48,6 +53,7 @@ signals:
     void countdownFinished();           // Fin du compte à rebours → GameLogic démarre
     void reservoirsRefilled();          // L'utilisateur a rempli les réservoirs
     void emergencyStopRequested();      // Arrêt d'urgence du robot demandé
+    void hintModeChanged(bool enabled); // Indices du joueur activés / désactivés (touche H)
 
 protected:
     void resizeEvent(QResizeEvent *event) override;
@@ -94,6 +100,12 @@ private:
     QTimer countdownTimer;
     int countdownValue = 3;
 
+    QLabel *searchStatsLabel;    // Overlay de debug : statistiques de la dernière recherche du robot
+
+    QLabel *hintsLabel;          // Indices : score de chaque colonne pendant le tour du joueur
+    bool hintsEnabled = false;
+    bool playerTurn = false;
+
     QLabel *warningLabel;        // Message d'avertissement (grille incomplète)
     QWidget *warningOverlay;     // Widget overlay pour le message
     QPushButton *warningQuitButton; // Bouton pour quitter quand grille incomplète
@@ -0,0 +1,76 @@
+#include "HintEngine.hpp"
+#include <QDebug>
+#include <cstdlib>
+
+HintEngine::HintEngine(QObject* parent)
+    : QObject(parent)
+{
+}
+
+HintEngine::~HintEngine()
+{
+    stop();
+}
+
+// =============================================================
+//   DÉMARRAGE / ARRÊT
+// =============================================================
+void HintEngine::start(const SimpleAI::Grid& grid, int player, int maxDepth)
+{
+    stop();
+    cancel = false;
+    task = worker.submit([this, grid, player, maxDepth]() { run(grid, player, maxDepth); });
+}
+
+void HintEngine::stop()
+{
+    cancel = true;
+    if (task.valid())
+    {
+        task.wait();
+        task = std::future<void>();
+    }
+}
+
+// =============================================================
+//   ANALYSE PAR PROFONDEURS CROISSANTES
+// =============================================================
+void HintEngine::run(SimpleAI::Grid grid, int player, int maxDepth)
+{
+    int emptyCells = 0;
+    for (const auto& row : grid)
+        for (int cell : row)
+            emptyCells += (cell == 0);
+
+    SimpleAI::SearchLimits limits;
+    limits.stop = &cancel;
+
+    // Profondeurs impaires seulement (feuilles toujours au même joueur) : les scores
+    // ne basculent pas d'une profondeur à l'autre selon le joueur qui a joué en dernier
+    for (int depth = 3; depth <= maxDepth && !cancel; depth += 2)
+    {
+        limits.maxDepth = depth;
+        const SimpleAI::PositionAnalysis analysis = SimpleAI::analyzeGrid(grid, player, limits);
+
+        // Profondeur interrompue : ses scores sont incomplets
+        if (cancel)
+            break;
+        if (analysis.bestMove < 0)
+            return;
+
+        emit hintsUpdated(analysis);
+
+        // Plus rien à apprendre : toutes les colonnes sont résolues ou la fin de partie est atteinte
+        bool solved = true;
+        for (int col = 0; col < SimpleAI::MAX_WIDTH; col++)
+        {
+            const int score = analysis.scores[col];
+            if (score != SimpleAI::INVALID_MOVE_SCORE && std::abs(score) < SimpleAI::WIN_SCORE)
+                solved = false;
+        }
+        if (solved || depth >= emptyCells)
+            break;
+    }
+
+    qDebug() << "[HintEngine] Analyse terminée (profondeur" << limits.maxDepth << ")";
+}
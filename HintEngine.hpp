@@ -0,0 +1,46 @@
+#pragma once
+
+#include <QObject>
+#include <atomic>
+#include <future>
+
+#include "Negamax.hpp"
+#include "WorkerPool.hpp"
+
+Q_DECLARE_METATYPE(SimpleAI::PositionAnalysis)
+
+// =============================================================
+//   INDICES DU JOUEUR (analyse en tâche de fond)
+// =============================================================
+// Pendant le tour du joueur, un thread de basse priorité calcule le score
+// de chaque colonne avec le moteur du robot (même table de transposition),
+// de plus en plus profond : hintsUpdated() est émis à chaque profondeur terminée.
+// Le thread ne prend que le temps processeur libre et l'analyse est annulée
+// en quelques millisecondes dès que le coup du joueur est confirmé.
+class HintEngine : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit HintEngine(QObject* parent = nullptr);
+    ~HintEngine();
+
+    // Démarre l'analyse de grid pour player (au trait), jusqu'à maxDepth
+    void start(const SimpleAI::Grid& grid, int player, int maxDepth);
+
+    // Annule l'analyse et attend son thread (quelques millisecondes au plus)
+    void stop();
+
+signals:
+    // Scores de la dernière profondeur terminée (émis depuis le thread d'analyse)
+    void hintsUpdated(SimpleAI::PositionAnalysis analysis);
+
+private:
+    void run(SimpleAI::Grid grid, int player, int maxDepth);
+
+    std::atomic<bool> cancel{false};
+    std::future<void> task;
+
+    // Déclaré en dernier pour être détruit en premier
+    SimpleAI::WorkerPool worker{1, SimpleAI::WorkerPool::Priority::Low};
+};
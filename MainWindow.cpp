@@ -142,6 +142,15 @@ MainWindow::MainWindow(QWidget *parent)
     connect(gameLogic, &GameLogic::robotStatus,
             gameScreen, &GameScreen::setRobotStatus);
 
+    connect(gameLogic, &GameLogic::searchStats,
+            gameScreen, &GameScreen::setSearchStats);
+
+    connect(gameLogic, &GameLogic::hintsUpdated,
+            gameScreen, &GameScreen::setHints);
+
+    connect(gameScreen, &GameScreen::hintModeChanged,
+            gameLogic, &GameLogic::setHintsEnabled);
+
     connect(gameLogic, &GameLogic::difficultyText,
             gameScreen, &GameScreen::setDifficultyText);
 
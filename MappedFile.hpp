@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// =============================================================
+//   FICHIER PROJETÉ EN MÉMOIRE (lecture seule)
+// =============================================================
+// Les pages ne sont chargées par le système qu'à leur première lecture :
+// ouvrir un gros fichier ne coûte ni temps ni mémoire au démarrage.
+class MappedFile
+{
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    // Projette le fichier en mémoire (false si absent, vide ou illisible)
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return data_ != nullptr; }
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void* file_ = nullptr;     // HANDLE du fichier
+    void* mapping_ = nullptr;  // HANDLE de la projection
+#endif
+};
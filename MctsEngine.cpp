@@ -0,0 +1,480 @@
+#include "MctsEngine.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+namespace SimpleAI
+{
+namespace
+{
+// Le budget de temps n'est vérifié que toutes les CHECK_INTERVAL itérations
+constexpr uint64_t CHECK_INTERVAL = 16;
+
+// Résultat à partir des statistiques des coups de la racine : le coup le plus visité
+// (à égalité le plus central), score = taux de gain du joueur au trait
+template <class Position>
+SearchResult rootResult(const uint32_t visits[Position::WIDTH], const float wins[Position::WIDTH])
+{
+    SearchResult result;
+    uint32_t best = 0;
+    for (int i = 0; i < Position::WIDTH; i++)
+    {
+        const int col = Position::CENTER_ORDER[i];
+        if (visits[col] > best)
+        {
+            best = visits[col];
+            result.move = col;
+        }
+    }
+    if (result.move >= 0)
+        result.score = static_cast<int>(std::lround((2.0f * wins[result.move] / best - 1.0f) * MCTS_SCORE));
+    return result;
+}
+}
+
+template <int Rows, int Cols>
+BasicMctsEngine<Rows, Cols>::BasicMctsEngine(const MctsOptions& options, uint64_t seed)
+    : options_(options)
+    , rng_(seed * 0x9E3779B97F4A7C15ULL | 1)
+{
+    options_.maxNodes = std::max<uint32_t>(options_.maxNodes, 2 * Position::WIDTH);
+    options_.playoutsPerLeaf = std::max(1, options_.playoutsPerLeaf);
+
+    // Arbre alloué une seule fois : aucune allocation pendant la recherche
+    nodes_.reserve(options_.maxNodes);
+    scratch_.reserve(options_.maxNodes);
+}
+
+template <int Rows, int Cols>
+void BasicMctsEngine<Rows, Cols>::clear()
+{
+    nodes_.clear();
+    hasTree_ = false;
+}
+
+// ---------------------------------------------------------
+// Générateur pseudo-aléatoire des playouts (xorshift64*)
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+uint64_t BasicMctsEngine<Rows, Cols>::random()
+{
+    rng_ ^= rng_ >> 12;
+    rng_ ^= rng_ << 25;
+    rng_ ^= rng_ >> 27;
+    return rng_ * 0x2545F4914F6CDD1DULL;
+}
+
+// ---------------------------------------------------------
+// Réutilisation de l'arbre de la recherche précédente
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+void BasicMctsEngine<Rows, Cols>::reuseTree(const Position& pos)
+{
+    auto samePosition = [&pos](const Position& p) {
+        return p.mask() == pos.mask() && p.current() == pos.current();
+    };
+
+    if (hasTree_ && !nodes_.empty())
+    {
+        uint32_t found = 0;
+        bool reused = samePosition(rootPos_);
+
+        // Coup du robot (profondeur 1) puis réponse du joueur (profondeur 2)
+        const Node& root = nodes_[0];
+        for (uint32_t i = root.firstChild; !reused && root.expanded && i < root.firstChild + root.childCount; i++)
+        {
+            Position child = rootPos_;
+            child.play(nodes_[i].move);
+            if (samePosition(child))
+            {
+                found = i;
+                reused = true;
+                break;
+            }
+
+            const Node& node = nodes_[i];
+            for (uint32_t j = node.firstChild; node.expanded && j < node.firstChild + node.childCount; j++)
+            {
+                Position grandChild = child;
+                grandChild.play(nodes_[j].move);
+                if (samePosition(grandChild))
+                {
+                    found = j;
+                    reused = true;
+                    break;
+                }
+            }
+        }
+
+        if (reused)
+        {
+            reroot(found);
+            rootPos_ = pos;
+            return;
+        }
+    }
+
+    // Position sans rapport avec l'arbre : nouvelle racine
+    nodes_.clear();
+    nodes_.push_back(Node());
+    rootPos_ = pos;
+    hasTree_ = true;
+}
+
+template <int Rows, int Cols>
+void BasicMctsEngine<Rows, Cols>::reroot(uint32_t newRoot)
+{
+    if (newRoot == 0)
+        return;
+
+    // Parcours en largeur : les enfants de chaque nœud restent contigus
+    scratch_.clear();
+    scratch_.push_back(nodes_[newRoot]);
+    scratch_[0].move = -1;
+    for (size_t i = 0; i < scratch_.size(); i++)
+    {
+        const Node node = scratch_[i];
+        if (!node.expanded)
+            continue;
+
+        scratch_[i].firstChild = static_cast<uint32_t>(scratch_.size());
+        for (uint32_t c = 0; c < node.childCount; c++)
+            scratch_.push_back(nodes_[node.firstChild + c]);
+    }
+    nodes_.swap(scratch_);
+}
+
+// ---------------------------------------------------------
+// Expansion : coups sûrs seulement, le coup gagnant seul s'il existe
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+bool BasicMctsEngine<Rows, Cols>::expand(uint32_t node, const Position& pos)
+{
+    if (nodes_.size() + Position::WIDTH > options_.maxNodes)
+        return false;  // arbre plein : la feuille reste une feuille
+
+    const bool win = pos.canWinNext();
+    Bitboard moves;
+    if (win)
+        moves = Position::winningCells(pos.current()) & pos.possible();
+    else
+    {
+        moves = pos.possibleNonLosingMoves();
+        if (!moves)
+            moves = pos.possible();  // tous les coups perdent
+    }
+
+    const uint32_t first = static_cast<uint32_t>(nodes_.size());
+    for (int i = 0; i < Position::WIDTH; i++)
+    {
+        const int col = Position::CENTER_ORDER[i];
+        if (!(moves & Position::columnMask(col)))
+            continue;
+
+        Node child;
+        child.move = static_cast<int8_t>(col);
+        if (win)
+            child.terminal = TERMINAL_WIN;
+        else if (pos.nbMoves() + 1 == Position::CELLS)
+            child.terminal = TERMINAL_DRAW;
+        nodes_.push_back(child);
+        if (win)
+            break;
+    }
+
+    nodes_[node].firstChild = first;
+    nodes_[node].childCount = static_cast<uint8_t>(nodes_.size() - first);
+    nodes_[node].expanded = 1;
+    return true;
+}
+
+// ---------------------------------------------------------
+// Sélection UCT : gain moyen + exploration
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+uint32_t BasicMctsEngine<Rows, Cols>::select(uint32_t node) const
+{
+    const Node& parent = nodes_[node];
+    const uint32_t end = parent.firstChild + parent.childCount;
+
+    // Un enfant jamais visité est essayé d'abord (dans l'ordre du centre)
+    for (uint32_t i = parent.firstChild; i < end; i++)
+        if (nodes_[i].visits == 0)
+            return i;
+
+    const float logVisits = std::log(static_cast<float>(parent.visits));
+    uint32_t best = parent.firstChild;
+    float bestValue = -1.0f;
+    for (uint32_t i = parent.firstChild; i < end; i++)
+    {
+        const Node& child = nodes_[i];
+        const float n = static_cast<float>(child.visits);
+        const float value = child.wins / n + options_.exploration * std::sqrt(logVisits / n);
+        if (value > bestValue)
+        {
+            bestValue = value;
+            best = i;
+        }
+    }
+    return best;
+}
+
+// ---------------------------------------------------------
+// Playout aléatoire sur bitboard
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+float BasicMctsEngine<Rows, Cols>::playout(Position pos)
+{
+    for (int ply = 0;; ply++)
+    {
+        if (pos.nbMoves() >= Position::CELLS)
+            return 0.5f;
+
+        // Le joueur au trait gagne dès qu'il le peut
+        if (pos.canWinNext())
+            return (ply % 2 == 0) ? 1.0f : 0.0f;
+
+        // Tous les coups laissent gagner l'adversaire
+        const Bitboard moves = pos.possibleNonLosingMoves();
+        if (!moves)
+            return (ply % 2 == 0) ? 0.0f : 1.0f;
+
+        int cols[Position::WIDTH];
+        int count = 0;
+        for (int col = 0; col < Position::WIDTH; col++)
+            if (moves & Position::columnMask(col))
+                cols[count++] = col;
+
+        pos.play(cols[((random() >> 32) * static_cast<uint64_t>(count)) >> 32]);
+    }
+}
+
+// ---------------------------------------------------------
+// Recherche "anytime"
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+SearchResult BasicMctsEngine<Rows, Cols>::search(const Position& pos, const SearchLimits& limits)
+{
+    const auto start = std::chrono::steady_clock::now();
+    playouts_ = 0;
+    maxDepth_ = 0;
+
+    SearchResult result;
+    if (pos.nbMoves() >= Position::CELLS || pos.lastPlayerWon())
+        return result;
+
+    reuseTree(pos);
+    if (!nodes_[0].expanded)
+        expand(0, pos);
+
+    // Coup unique (victoire immédiate ou parade) : rien à chercher
+    if (nodes_[0].childCount == 1)
+    {
+        const Node& only = nodes_[nodes_[0].firstChild];
+        result.move = only.move;
+        result.score = (only.terminal == TERMINAL_WIN) ? WIN_SCORE + (Position::CELLS - pos.nbMoves()) : 0;
+        return result;
+    }
+
+    const bool timed = limits.time.count() > 0;
+    const auto deadline = start + limits.time;
+    uint64_t playoutLimit = limits.nodes;
+    if (!timed && !playoutLimit && !limits.stop)
+        playoutLimit = DEFAULT_PLAYOUTS;
+
+    const uint32_t batch = static_cast<uint32_t>(options_.playoutsPerLeaf);
+    uint32_t path[MAX_CELLS + 1];
+
+    for (uint64_t iteration = 0;; iteration++)
+    {
+        if (limits.stop && limits.stop->load(std::memory_order_relaxed))
+            break;
+        if (playoutLimit && playouts_ >= playoutLimit)
+            break;
+        if (timed && iteration % CHECK_INTERVAL == 0 && std::chrono::steady_clock::now() >= deadline)
+            break;
+
+        // Sélection jusqu'à une feuille, expansion à sa deuxième visite
+        Position p = pos;
+        uint32_t node = 0;
+        int length = 0;
+        path[length++] = 0;
+        for (;;)
+        {
+            const Node& current = nodes_[node];
+            if (current.terminal)
+                break;
+            if (!current.expanded && (current.visits == 0 || !expand(node, p)))
+                break;
+
+            node = select(node);
+            p.play(nodes_[node].move);
+            path[length++] = node;
+        }
+        maxDepth_ = std::max(maxDepth_, length - 1);
+
+        // Gains du joueur qui a joué le dernier coup du chemin
+        uint32_t visits = 1;
+        float reward;
+        if (nodes_[node].terminal == TERMINAL_WIN)
+            reward = 1.0f;
+        else if (nodes_[node].terminal == TERMINAL_DRAW)
+            reward = 0.5f;
+        else
+        {
+            // Playouts groupés : la sélection est amortie sur plusieurs parties
+            visits = batch;
+            reward = 0.0f;
+            for (uint32_t i = 0; i < batch; i++)
+                reward += 1.0f - playout(p);
+            playouts_ += batch;
+        }
+
+        // Rétropropagation, le point de vue alterne à chaque niveau
+        for (int i = length - 1; i >= 0; i--)
+        {
+            Node& n = nodes_[path[i]];
+            n.visits += visits;
+            n.wins += reward;
+            reward = static_cast<float>(visits) - reward;
+        }
+    }
+
+    uint32_t visits[Position::WIDTH];
+    float wins[Position::WIDTH];
+    rootStats(visits, wins);
+    result = rootResult<Position>(visits, wins);
+    result.depth = maxDepth_;
+    result.nodes = playouts_;
+    return result;
+}
+
+template <int Rows, int Cols>
+void BasicMctsEngine<Rows, Cols>::rootStats(uint32_t visits[Position::WIDTH], float wins[Position::WIDTH]) const
+{
+    std::fill(visits, visits + Position::WIDTH, 0u);
+    std::fill(wins, wins + Position::WIDTH, 0.0f);
+    if (nodes_.empty() || !nodes_[0].expanded)
+        return;
+
+    const Node& root = nodes_[0];
+    for (uint32_t i = root.firstChild; i < root.firstChild + root.childCount; i++)
+    {
+        visits[nodes_[i].move] = nodes_[i].visits;
+        wins[nodes_[i].move] = nodes_[i].wins;
+    }
+}
+
+template <int Rows, int Cols>
+int BasicMctsEngine<Rows, Cols>::principalVariation(int8_t pv[MAX_CELLS]) const
+{
+    int length = 0;
+    uint32_t node = 0;
+    while (!nodes_.empty() && nodes_[node].expanded && nodes_[node].childCount > 0 && length < MAX_CELLS)
+    {
+        const Node& parent = nodes_[node];
+        uint32_t best = parent.firstChild;
+        for (uint32_t i = parent.firstChild + 1; i < parent.firstChild + parent.childCount; i++)
+            if (nodes_[i].visits > nodes_[best].visits)
+                best = i;
+        if (nodes_[best].visits == 0)
+            break;
+
+        pv[length++] = nodes_[best].move;
+        node = best;
+    }
+    return length;
+}
+
+// ---------------------------------------------------------
+// Parallélisme à la racine : un arbre par thread, visites additionnées
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+SearchResult searchMcts(BasicMctsEngine<Rows, Cols>* const* engines, int count,
+                        const BasicPosition<Rows, Cols>& pos, const SearchLimits& limits,
+                        SearchStats* stats, WorkerPool* pool)
+{
+    using Position = BasicPosition<Rows, Cols>;
+
+    const auto start = std::chrono::steady_clock::now();
+    count = std::max(1, count);
+
+    SearchLimits perEngine = limits;
+    if (limits.nodes)
+        perEngine.nodes = std::max<uint64_t>(1, limits.nodes / count);
+
+    std::vector<std::thread> helpers;
+    std::vector<std::future<void>> pooled;
+    for (int i = 1; i < count; i++)
+    {
+        auto helperSearch = [&, i]() { engines[i]->search(pos, perEngine); };
+        if (pool)
+            pooled.push_back(pool->submit(helperSearch));
+        else
+            helpers.emplace_back(helperSearch);
+    }
+
+    SearchResult result = engines[0]->search(pos, perEngine);
+
+    for (std::thread& t : helpers)
+        t.join();
+    for (std::future<void>& f : pooled)
+        f.wait();
+
+    // Coups de la racine de tous les arbres (aucun si le coup était forcé)
+    if (count > 1 && result.nodes > 0)
+    {
+        uint32_t visits[Position::WIDTH] = {};
+        float wins[Position::WIDTH] = {};
+        for (int i = 0; i < count; i++)
+        {
+            uint32_t v[Position::WIDTH];
+            float w[Position::WIDTH];
+            engines[i]->rootStats(v, w);
+            for (int col = 0; col < Position::WIDTH; col++)
+            {
+                visits[col] += v[col];
+                wins[col] += w[col];
+            }
+        }
+
+        result = rootResult<Position>(visits, wins);
+        for (int i = 0; i < count; i++)
+        {
+            result.nodes += engines[i]->playouts();
+            result.depth = std::max(result.depth, engines[i]->depth());
+        }
+    }
+
+    if (stats)
+    {
+        *stats = SearchStats();
+        stats->source = SearchSource::Mcts;
+        stats->nodes = result.nodes;
+        stats->depth = result.depth;
+        stats->pvLength = engines[0]->principalVariation(stats->pv);
+        if (result.move >= 0 && (stats->pvLength == 0 || stats->pv[0] != result.move))
+        {
+            stats->pv[0] = static_cast<int8_t>(result.move);
+            stats->pvLength = 1;
+        }
+        stats->time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+    }
+    return result;
+}
+
+// ---------------------------------------------------------
+// Grilles gérées : 7 x 6 (standard), 8 x 7, 9 x 7
+// ---------------------------------------------------------
+template class BasicMctsEngine<6, 7>;
+template class BasicMctsEngine<7, 8>;
+template class BasicMctsEngine<7, 9>;
+
+template SearchResult searchMcts(BasicMctsEngine<6, 7>* const*, int, const BasicPosition<6, 7>&,
+                                 const SearchLimits&, SearchStats*, WorkerPool*);
+template SearchResult searchMcts(BasicMctsEngine<7, 8>* const*, int, const BasicPosition<7, 8>&,
+                                 const SearchLimits&, SearchStats*, WorkerPool*);
+template SearchResult searchMcts(BasicMctsEngine<7, 9>* const*, int, const BasicPosition<7, 9>&,
+                                 const SearchLimits&, SearchStats*, WorkerPool*);
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "WorkerPool.hpp"
+
+namespace SimpleAI
+{
+// Score d'une recherche Monte-Carlo : taux de gain ramené à [-MCTS_SCORE, +MCTS_SCORE]
+// (toujours sous WIN_SCORE : aucune victoire n'est prouvée par des playouts)
+constexpr int MCTS_SCORE = 1000;
+
+// Réglages de la recherche Monte-Carlo (la force se règle par le budget et ces paramètres)
+struct MctsOptions
+{
+    float exploration = 1.0f;        // constante d'exploration de UCT
+    int playoutsPerLeaf = 4;         // playouts joués ensemble à chaque feuille atteinte
+    uint32_t maxNodes = 1u << 19;    // nœuds de l'arbre (alloués une seule fois, 16 octets chacun)
+};
+
+// =============================================================
+//   MOTEUR MONTE-CARLO (UCT) SUR BITBOARD
+// =============================================================
+// Sélection par UCT, expansion de tous les coups sûrs de la feuille
+// (le coup gagnant seul s'il existe), playouts aléatoires sur bitboard :
+// un playout gagne dès qu'il le peut et évite les coups perdants immédiats.
+// L'arbre est conservé entre les recherches : si la nouvelle position en
+// descend (coup du robot puis réponse du joueur), son sous-arbre devient la racine.
+// Une version par taille de grille (instanciée dans MctsEngine.cpp).
+template <int Rows, int Cols>
+class BasicMctsEngine
+{
+public:
+    using Position = BasicPosition<Rows, Cols>;
+    using Bitboard = typename Position::Bitboard;
+
+    // seed : graine du générateur des playouts (une différente par thread)
+    explicit BasicMctsEngine(const MctsOptions& options = MctsOptions(), uint64_t seed = 1);
+
+    // Recherche "anytime" : playouts jusqu'à épuisement du budget (limits.time,
+    // limits.nodes = nombre de playouts, limits.stop), le coup le plus visité est retourné.
+    // Sans aucune limite, DEFAULT_PLAYOUTS playouts sont joués.
+    SearchResult search(const Position& pos, const SearchLimits& limits);
+
+    // Visites et gains (du point de vue du joueur au trait) de chaque colonne à la racine
+    void rootStats(uint32_t visits[Position::WIDTH], float wins[Position::WIDTH]) const;
+
+    // Variante la plus visitée depuis la racine, retourne sa longueur
+    int principalVariation(int8_t pv[MAX_CELLS]) const;
+
+    // Playouts joués par la dernière recherche
+    uint64_t playouts() const { return playouts_; }
+
+    // Profondeur maximale atteinte dans l'arbre par la dernière recherche
+    int depth() const { return maxDepth_; }
+
+    // Oublie l'arbre (nouvelle partie)
+    void clear();
+
+    static constexpr uint64_t DEFAULT_PLAYOUTS = 100000;
+
+private:
+    struct Node
+    {
+        uint32_t firstChild = 0;  // index du premier enfant (enfants contigus)
+        uint32_t visits = 0;
+        float wins = 0.0f;        // gains du joueur qui a joué move (victoire 1, nul 0.5)
+        int8_t move = -1;         // colonne jouée pour arriver ici
+        uint8_t childCount = 0;
+        uint8_t terminal = 0;     // NOT_TERMINAL, TERMINAL_WIN (move gagne) ou TERMINAL_DRAW
+        uint8_t expanded = 0;
+    };
+
+    static constexpr uint8_t NOT_TERMINAL = 0;
+    static constexpr uint8_t TERMINAL_WIN = 1;
+    static constexpr uint8_t TERMINAL_DRAW = 2;
+
+    // Reprend le sous-arbre de pos (jusqu'à deux coups sous l'ancienne racine), sinon repart de zéro
+    void reuseTree(const Position& pos);
+
+    // Recopie le sous-arbre de newRoot au début de l'arbre (compactage)
+    void reroot(uint32_t newRoot);
+
+    // Crée les enfants de node (coups sûrs dans l'ordre du centre), false si l'arbre est plein
+    bool expand(uint32_t node, const Position& pos);
+
+    // Enfant de node qui maximise UCT
+    uint32_t select(uint32_t node) const;
+
+    // Partie aléatoire jusqu'à la fin : 1 si le joueur au trait gagne, 0 s'il perd, 0.5 si nul
+    float playout(Position pos);
+
+    // Générateur xorshift64* (aucun état partagé entre threads)
+    uint64_t random();
+
+    MctsOptions options_;
+    uint64_t rng_;
+    std::vector<Node> nodes_;
+    std::vector<Node> scratch_;   // tampon du compactage
+    Position rootPos_;
+    bool hasTree_ = false;
+    uint64_t playouts_ = 0;
+    int maxDepth_ = 0;
+};
+
+// Recherche Monte-Carlo sur plusieurs threads (parallélisme à la racine) :
+// chaque moteur développe son propre arbre, les visites des coups de la racine sont
+// additionnées. engines[0] tourne sur le thread appelant, les autres sur pool
+// (au moins count - 1 threads libres, sinon ils sont créés pour la recherche).
+// limits.nodes (nombre de playouts) est réparti entre les moteurs.
+// stats (optionnel) : source Mcts, playouts, profondeur maximale et variante principale.
+template <int Rows, int Cols>
+SearchResult searchMcts(BasicMctsEngine<Rows, Cols>* const* engines, int count,
+                        const BasicPosition<Rows, Cols>& pos, const SearchLimits& limits,
+                        SearchStats* stats = nullptr, WorkerPool* pool = nullptr);
+
+// Moteur de la grille standard
+using MctsEngine = BasicMctsEngine<6, 7>;
+}
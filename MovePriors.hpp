@@ -0,0 +1,76 @@
+#pragma once
+
+#include <cstdint>
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   PRIORITÉS DE COUPS PRÉCALCULÉES (politique du réseau)
+// =============================================================
+// Table fixe, remplie avant la recherche pour les positions proches
+// de la racine (computePriors()) puis lue sans verrou par tous les
+// threads de recherche : NegamaxEngine trie alors les coups de ces
+// positions par la politique du réseau au lieu du nombre de menaces.
+// Adressage ouvert par clé de position, aucune allocation.
+class MovePriors
+{
+public:
+    static constexpr int CAPACITY = 1024;   // puissance de 2, plus que 1 + 7 + 49 + 343 positions
+
+    // Oublie toutes les positions ; seules celles de moins de maxPly pions seront cherchées
+    void clear(int maxPly)
+    {
+        for (Slot& s : slots_)
+            s.used = false;
+        count_ = 0;
+        maxPly_ = maxPly;
+    }
+
+    int size() const { return count_; }
+
+    // Mémorise la politique (0..255 par colonne) d'une position, false si la table est pleine
+    bool store(uint64_t key, const uint8_t policy[MAX_WIDTH])
+    {
+        if (count_ >= CAPACITY / 2)
+            return false;
+        Slot* s = &slots_[key & (CAPACITY - 1)];
+        while (s->used && s->key != key)
+            s = &slots_[(s - slots_ + 1) & (CAPACITY - 1)];
+        if (!s->used)
+            count_++;
+        s->key = key;
+        s->used = true;
+        for (int col = 0; col < MAX_WIDTH; col++)
+            s->policy[col] = policy[col];
+        return true;
+    }
+
+    // Politique d'une position de nbMoves pions, nullptr si elle n'a pas été évaluée
+    const uint8_t* find(uint64_t key, int nbMoves) const
+    {
+        if (nbMoves >= maxPly_)
+            return nullptr;
+        const Slot* s = &slots_[key & (CAPACITY - 1)];
+        while (s->used)
+        {
+            if (s->key == key)
+                return s->policy;
+            s = &slots_[(s - slots_ + 1) & (CAPACITY - 1)];
+        }
+        return nullptr;
+    }
+
+private:
+    struct Slot
+    {
+        uint64_t key = 0;
+        uint8_t policy[MAX_WIDTH] = {};
+        bool used = false;
+    };
+
+    Slot slots_[CAPACITY];
+    int count_ = 0;
+    int maxPly_ = 0;
+};
+}
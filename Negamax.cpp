@@ -1,14 +1,307 @@
 #include "Negamax.hpp"
+#include "MctsEngine.hpp"
+#include "NegamaxEngine.hpp"
+#include "NeuralSearch.hpp"
+#include "Ponderer.hpp"
+#include "Solver.hpp"
+#include "WinLines.hpp"
+#include "WorkerPool.hpp"
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <vector>
 
 namespace SimpleAI
 {
+// ---------------------------------------------------------
+// Table de transposition partagée
+// ---------------------------------------------------------
+TranspositionTable& transpositionTable()
+{
+    static TranspositionTable table;
+    return table;
+}
+
+void setTranspositionTableSize(size_t entries)
+{
+    transpositionTable().resize(entries);
+}
+
+// ---------------------------------------------------------
+// Nombre de threads de recherche
+// ---------------------------------------------------------
+namespace
+{
+std::atomic<int> threadCount{1};
+
+OpeningBook& book()
+{
+    static OpeningBook instance;
+    return instance;
+}
+
+Solver& solver()
+{
+    static Solver instance;
+    return instance;
+}
+
+PositionCache& cache()
+{
+    static PositionCache instance;
+    return instance;
+}
+
+// Threads permanents : auxiliaires Lazy SMP et réflexion anticipée
+// (créés à la première recherche avec le nombre de threads de setSearchThreads())
+WorkerPool& workerPool()
+{
+    static WorkerPool instance(threadCount);
+    return instance;
+}
+
+// Threads permanents de l'analyse de positions (en plus du thread appelant)
+WorkerPool& analysisPool()
+{
+    static WorkerPool instance(threadCount - 1);
+    return instance;
+}
+
+// Réseau valeur / politique : lu par le thread du robot, remplacé au démarrage seulement
+std::shared_ptr<NeuralNetwork> network;
+
+// Positions évaluées par le réseau avant chaque recherche : racine et deux coups (57 positions, un seul lot)
+constexpr int NEURAL_PRIOR_PLIES = 3;
+
+// Politique du réseau de la recherche en cours : remplie par le thread du robot,
+// lue sans verrou par tous les threads de searchParallel (comme la table de transposition)
+MovePriors& movePriors()
+{
+    static MovePriors instance;
+    return instance;
+}
+
+Ponderer& ponderer()
+{
+    static Ponderer instance(&transpositionTable(), &solver(), &workerPool());
+    return instance;
+}
+
+// Résultat du cache persistant, s'il est exact ou au moins aussi profond que demandé
+bool probeCache(const Position& pos, int depth, SearchResult& result)
+{
+    if (!cache().isOpen())
+        return false;
+
+    PositionCache::Record record;
+    if (!cache().probe(pos, record) || !pos.canPlay(record.move))
+        return false;
+    if (!record.solved && record.depth < depth)
+        return false;
+
+    result.move = record.move;
+    result.score = record.score;
+    result.depth = record.depth;
+    result.nodes = 0;
+    return true;
+}
+
+// Mémorise un résultat de recherche dans le cache persistant
+// (pas le coup de secours d'une recherche annulée avant la fin de la première itération).
+// Exact seulement s'il vient du solveur ou si la recherche a couvert toutes les cases restantes :
+// une fin de partie trouvée à profondeur limitée ne retarde la défaite qu'à l'horizon de la recherche
+SearchResult remember(const Position& pos, const SearchResult& result, bool solved)
+{
+    if (result.move >= 0 && result.depth > 0 && cache().isOpen())
+    {
+        solved = solved || result.depth >= Position::CELLS - pos.nbMoves();
+        cache().store(pos, result.score, result.move, result.depth, solved);
+    }
+    return result;
+}
+
+// Statistiques d'un coup obtenu sans recherche Negamax (bibliothèque, cache, réflexion, solveur)
+SearchResult withStats(SearchStats* stats, SearchSource source, const SearchResult& result,
+                       std::chrono::steady_clock::time_point start)
+{
+    if (stats)
+    {
+        *stats = SearchStats();
+        stats->source = source;
+        stats->nodes = result.nodes;
+        stats->depth = result.depth;
+        stats->time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+        if (result.move >= 0)
+        {
+            stats->pv[0] = static_cast<int8_t>(result.move);
+            stats->pvLength = 1;
+        }
+    }
+    return result;
+}
+
+// Coup de la bibliothèque d'ouvertures pour cette position, si elle y figure
+bool probeBook(const Position& pos, SearchResult& result, bool requireSolved = false)
+{
+    if (pos.nbMoves() > book().maxPly())
+        return false;
+
+    int move = -1;
+    int score = 0;
+    bool solved = false;
+    if (!book().probe(pos, move, score, &solved) || move < 0 || !pos.canPlay(move))
+        return false;
+    if (requireSolved && !solved)
+        return false;
+
+    result.move = move;
+    result.score = score;
+    result.depth = 0;
+    result.nodes = 0;
+    return true;
+}
+
+// Grid -> bitboard d'une taille de grille donnée (ligne 0 de la grille en haut)
+template <class P>
+P gridToPosition(const Grid& grid, int player)
+{
+    typename P::Bitboard current = 0;
+    typename P::Bitboard mask = 0;
+
+    for (int r = 0; r < grid.size() && r < P::HEIGHT; r++)
+    {
+        for (int c = 0; c < grid[r].size() && c < P::WIDTH; c++)
+        {
+            if (grid[r][c] == 0)
+                continue;
+
+            // La ligne 0 de la grille est en haut, le bitboard compte depuis le bas
+            const typename P::Bitboard cell = P::cellMask(P::HEIGHT - 1 - r, c);
+            mask |= cell;
+            if (grid[r][c] == player)
+                current |= cell;
+        }
+    }
+
+    return P(current, mask);
+}
+
+// Fonctions spécialisées pour une taille de grille : choisies une seule fois par
+// setBoardSize(), aucune dimension n'est ensuite testée pendant la recherche
+struct BoardRules
+{
+    int rows;
+    int cols;
+    SearchResult (*search)(const Grid&, const SearchLimits&, int, SearchMode, SearchStats*);
+    SearchResult (*mcts)(const Grid&, const SearchLimits&, int, SearchStats*);
+    PositionAnalysis (*analyze)(const Grid&, int, const SearchLimits&);
+    bool (*hasAlignment)(const Grid&, int);
+    bool (*winsAt)(const Grid&, int, int);
+    int (*evaluate)(const Grid&, int);
+};
+
+extern const BoardRules STANDARD_RULES;
+const BoardRules& boardRules();
+}
+
+void setSearchThreads(int threads)
+{
+    threadCount = std::max(1, threads);
+}
+
+int searchThreads()
+{
+    return threadCount;
+}
+
+// ---------------------------------------------------------
+// Réflexion pendant le tour de l'adversaire
+// ---------------------------------------------------------
+void startPondering(const Grid& grid, const SearchLimits& budget, int robotPlayer, SearchMode mode)
+{
+    // Le Ponderer ne connaît que la grille standard et la recherche Negamax / solveur
+    // (Monte-Carlo : l'arbre conservé entre les coups tient lieu de réflexion anticipée)
+    if (&boardRules() != &STANDARD_RULES || mode == SearchMode::Mcts)
+        return;
+
+    Position pos = toPosition(grid, robotPlayer == 1 ? 2 : 1);
+    if (pos.lastPlayerWon() || pos.nbMoves() >= Position::CELLS - 1)
+    {
+        ponderer().stop();
+        return;
+    }
+
+    ponderer().start(pos, budget, mode == SearchMode::Solver);
+}
+
+void stopPondering()
+{
+    ponderer().stop();
+}
+
+// ---------------------------------------------------------
+// Analyse de plusieurs positions
+// ---------------------------------------------------------
+void analyzeBatch(const Position* positions, size_t count, const SearchLimits& limits, PositionAnalysis* results)
+{
+    analyzeBatch(positions, count, limits, results, searchThreads(), &transpositionTable(), &analysisPool());
+}
+
+PositionAnalysis analyzeGrid(const Grid& grid, int player, const SearchLimits& limits)
+{
+    return boardRules().analyze(grid, player, limits);
+}
+
+// ---------------------------------------------------------
+// Bibliothèque d'ouvertures
+// ---------------------------------------------------------
+bool loadOpeningBook(const std::string& path)
+{
+    return book().open(path);
+}
+
+const OpeningBook& openingBook()
+{
+    return book();
+}
+
+// ---------------------------------------------------------
+// Réseau valeur / politique
+// ---------------------------------------------------------
+void setNeuralNetwork(std::shared_ptr<NeuralNetwork> net)
+{
+    network = std::move(net);
+}
+
+// ---------------------------------------------------------
+// Cache persistant des positions
+// ---------------------------------------------------------
+bool loadPositionCache(const std::string& path)
+{
+    return cache().open(path, ENGINE_VERSION);
+}
+
+PositionCache& positionCache()
+{
+    return cache();
+}
+
+// ---------------------------------------------------------
+// Conversion Grid -> bitboard
+// ---------------------------------------------------------
+Position toPosition(const Grid& grid, int player)
+{
+    return gridToPosition<Position>(grid, player);
+}
+
 // ---------------------------------------------------------
 // Vérifie si la colonne est jouable
 // ---------------------------------------------------------
 bool isValidMove(const Grid& grid, int col)
 {
-    if (col < 0 || col >= 7) return false;
+    if (grid.empty() || col < 0 || col >= grid[0].size()) return false;
     return (grid[0][col] == 0);
 }
 
@@ -18,7 +311,7 @@ bool isValidMove(const Grid& grid, int col)
 Grid playMove(const Grid& grid, int col, int player)
 {
     Grid g = grid;
-    for (int r = 5; r >= 0; r--)
+    for (int r = g.size() - 1; r >= 0; r--)
     {
         if (g[r][col] == 0)
         {
@@ -34,126 +327,330 @@ Grid playMove(const Grid& grid, int col, int player)
 // ---------------------------------------------------------
 bool isWinningMove(const Grid& g, int player)
 {
-    // Horizontal
-    for (int r = 0; r < 6; r++)
+    return boardRules().hasAlignment(g, player);
+}
+
+bool isWinningMoveAt(const Grid& g, int row, int col)
+{
+    if (row < 0 || row >= g.size() || col < 0 || col >= g[row].size() || g[row][col] == 0)
+        return false;
+    return boardRules().winsAt(g, row, col);
+}
+
+// ---------------------------------------------------------
+// Évaluation du point de vue du robot (joueur 2)
+// ---------------------------------------------------------
+int evaluate(const Grid& grid)
+{
+    return boardRules().evaluate(grid, 2);
+}
+
+// ---------------------------------------------------------
+// Negamax sur une grille (conversion puis recherche bitboard)
+// player = 1 (humain) ou 2 (robot)
+// ---------------------------------------------------------
+int negamax(const Grid& grid, int depth, int alpha, int beta, int player)
+{
+    Position pos = toPosition(grid, player);
+    if (pos.lastPlayerWon())
+        return -WIN_SCORE;
+
+    NegamaxEngine engine;
+    return engine.negamax(pos, depth, alpha, beta);
+}
+
+// ---------------------------------------------------------
+// Recherche du meilleur coup
+// ---------------------------------------------------------
+int getBestMove(const Grid& grid, int depth, int robotPlayer, SearchStats* stats)
+{
+    if (&boardRules() != &STANDARD_RULES)
     {
-        for (int c = 0; c < 4; c++)
-        {
-            if (g[r][c] == player &&
-                g[r][c + 1] == player &&
-                g[r][c + 2] == player &&
-                g[r][c + 3] == player)
-                return true;
-        }
+        SearchLimits limits;
+        limits.maxDepth = depth;
+        return boardRules().search(grid, limits, robotPlayer, SearchMode::Negamax, stats).move;
     }
 
-    // Vertical
-    for (int c = 0; c < 7; c++)
+    const auto start = std::chrono::steady_clock::now();
+    Position pos = toPosition(grid, robotPlayer);
+
+    SearchResult bookMove;
+    if (probeBook(pos, bookMove))
+        return withStats(stats, SearchSource::Book, bookMove, start).move;
+
+    SearchResult cached;
+    if (probeCache(pos, depth, cached))
+        return withStats(stats, SearchSource::Cache, cached, start).move;
+
+    NegamaxEngine engine(&transpositionTable());
+    SearchResult result;
+    result.move = engine.bestMove(pos, depth, &result.score);
+    result.depth = depth;
+    remember(pos, result, false);
+    if (stats)
+        *stats = engine.stats();
+
+    return (result.move >= 0) ? result.move : 3;  // centre par défaut
+}
+
+// ---------------------------------------------------------
+// Recherche du meilleur coup avec budget
+// ---------------------------------------------------------
+SearchResult getBestMoveTimed(const Grid& grid, const SearchLimits& budget, int robotPlayer,
+                              SearchMode mode, SearchStats* stats)
+{
+    if (mode == SearchMode::Mcts)
     {
-        for (int r = 0; r < 3; r++)
+        ponderer().stop();  // son thread sert aux playouts
+        return boardRules().mcts(grid, budget, robotPlayer, stats);
+    }
+    return boardRules().search(grid, budget, robotPlayer, mode, stats);
+}
+
+namespace
+{
+// ---------------------------------------------------------
+// Grille standard : bibliothèque, cache, réflexion, solveur puis recherche
+// ---------------------------------------------------------
+SearchResult searchStandard(const Grid& grid, const SearchLimits& budget, int robotPlayer,
+                            SearchMode mode, SearchStats* stats)
+{
+    const auto start = std::chrono::steady_clock::now();
+    Position pos = toPosition(grid, robotPlayer);
+
+    // Le mode solveur ne joue que des coups parfaits : entrées heuristiques ignorées
+    SearchResult bookMove;
+    if (probeBook(pos, bookMove, mode == SearchMode::Solver))
+        return withStats(stats, SearchSource::Book, bookMove, start);
+
+    // Position déjà cherchée lors d'une partie précédente (Difficile : score exact uniquement)
+    SearchResult cached;
+    if (probeCache(pos, mode == SearchMode::Solver ? Position::CELLS : budget.maxDepth, cached))
+        return withStats(stats, SearchSource::Cache, cached, start);
+
+    SearchLimits limits = budget;
+
+    // Réponse préparée pendant le tour de l'adversaire (la réflexion libère son thread)
+    ponderer().stop();
+    SearchResult pondered;
+    bool solved = false;
+    std::chrono::milliseconds spent{0};
+    if (ponderer().result(pos.key(), pondered, solved, spent) && pos.canPlay(pondered.move))
+    {
+        if (solved)
         {
-            if (g[r][c] == player &&
-                g[r + 1][c] == player &&
-                g[r + 2][c] == player &&
-                g[r + 3][c] == player)
-                return true;
+            pondered.score = Solver::toSearchScore(pondered.score);
+            return withStats(stats, SearchSource::Ponder, remember(pos, pondered, true), start);
         }
+        if (pondered.depth >= budget.maxDepth || std::abs(pondered.score) >= WIN_SCORE)
+            return withStats(stats, SearchSource::Ponder, remember(pos, pondered, false), start);
+
+        // Les itérations déjà faites sont dans la table : le budget est réduit d'autant
+        if (budget.time.count() > 0)
+            limits.time = std::max(budget.time / 4, budget.time - spent);
     }
 
-    // Diagonale /
-    for (int r = 3; r < 6; r++)
+    if (mode == SearchMode::Solver && pos.nbMoves() < Position::CELLS)
     {
-        for (int c = 0; c < 4; c++)
+        const auto solverStart = std::chrono::steady_clock::now();
+        solver().setTimeLimit(limits.time / 2);
+        solver().setStopFlag(limits.stop);
+
+        int scores[Position::WIDTH];
+        int move = -1;
+        const bool solvedInTime = solver().analyze(pos, scores, move);
+        solver().setStopFlag(nullptr);
+        if (solvedInTime && move >= 0)
         {
-            if (g[r][c] == player &&
-                g[r - 1][c + 1] == player &&
-                g[r - 2][c + 2] == player &&
-                g[r - 3][c + 3] == player)
-                return true;
+            SearchResult solved;
+            solved.move = move;
+            solved.score = Solver::toSearchScore(scores[move]);
+            solved.depth = Position::CELLS - pos.nbMoves();
+            solved.nodes = solver().nodes();
+            return withStats(stats, SearchSource::Solver, remember(pos, solved, true), start);
+        }
+
+        // Non résolu à temps : le reste du budget pour la recherche heuristique
+        if (limits.time.count() > 0)
+        {
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - solverStart);
+            limits.time = std::max(std::chrono::milliseconds(1), limits.time - elapsed);
         }
     }
 
-    // Diagonale
-    for (int r = 3; r < 6; r++)
+    // Politique du réseau près de la racine, partagée par tous les threads de la recherche :
+    // le temps d'inférence est pris sur le budget du coup
+    SearchOptions options;
+    if (network)
     {
-        for (int c = 3; c < 7; c++)
+        const auto networkStart = std::chrono::steady_clock::now();
+        computePriors(*network, pos, NEURAL_PRIOR_PLIES, movePriors());
+        options.priors = &movePriors();
+
+        if (limits.time.count() > 0)
         {
-            if (g[r][c] == player &&
-                g[r - 1][c - 1] == player &&
-                g[r - 2][c - 2] == player &&
-                g[r - 3][c - 3] == player)
-                return true;
+            const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+                std::chrono::steady_clock::now() - networkStart);
+            limits.time = std::max(std::chrono::milliseconds(1), limits.time - elapsed);
         }
     }
 
-    return false;
+    SearchResult result = searchParallel(pos, limits, searchThreads(), &transpositionTable(),
+                                         options, stats, &workerPool());
+    remember(pos, result, false);
+    if (stats)
+        stats->time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    if (result.move < 0)
+        result.move = 3;  // centre par défaut
+    return result;
 }
 
 // ---------------------------------------------------------
-// Évaluation simple (plus rapide que la tienne)
+// Autres grilles : recherche spécialisée uniquement
+// (bibliothèque, cache, réflexion et solveur sont propres au 7 x 6)
 // ---------------------------------------------------------
-int evaluate(const Grid& grid)
+template <int Rows, int Cols>
+SearchResult searchVariant(const Grid& grid, const SearchLimits& budget, int robotPlayer,
+                           SearchMode, SearchStats* stats)
 {
-    if (isWinningMove(grid, 2)) return +10000;  // robot gagne
-    if (isWinningMove(grid, 1)) return -10000;  // joueur gagne
-    return 0;
+    using VariantPosition = BasicPosition<Rows, Cols>;
+
+    const auto start = std::chrono::steady_clock::now();
+    const VariantPosition pos = gridToPosition<VariantPosition>(grid, robotPlayer);
+
+    SearchResult result = searchParallel(pos, budget, searchThreads(), &transpositionTable(),
+                                         SearchOptions(), stats, &workerPool());
+    if (stats)
+        stats->time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start);
+
+    if (result.move < 0)
+        result.move = VariantPosition::WIDTH / 2;  // centre par défaut
+    return result;
 }
 
 // ---------------------------------------------------------
-// Negamax récursif
-// player = 1 (humain) ou 2 (robot)
+// Recherche Monte-Carlo (toutes les grilles) : un arbre par thread,
+// conservés d'un coup à l'autre pour reprendre le sous-arbre de la position
 // ---------------------------------------------------------
-int negamax(const Grid& grid, int depth, int alpha, int beta, int player)
+template <int Rows, int Cols>
+SearchResult searchMonteCarlo(const Grid& grid, const SearchLimits& budget, int robotPlayer, SearchStats* stats)
 {
-    int eval = evaluate(grid);
-    if (depth == 0 || eval != 0)
-        return (player == 2 ? eval : -eval);
-
-    int best = -999999;
+    using Engine = BasicMctsEngine<Rows, Cols>;
+    using VariantPosition = BasicPosition<Rows, Cols>;
 
-    for (int col = 0; col < 7; col++)
+    static std::vector<std::unique_ptr<Engine>> engines;
+    static std::vector<Engine*> enginePointers;
+    const int threads = searchThreads();
+    while (static_cast<int>(engines.size()) < threads)
     {
-        if (!isValidMove(grid, col))
-            continue;
+        engines.push_back(std::make_unique<Engine>(MctsOptions(), engines.size() + 1));
+        enginePointers.push_back(engines.back().get());
+    }
 
-        Grid child = playMove(grid, col, player);
+    const VariantPosition pos = gridToPosition<VariantPosition>(grid, robotPlayer);
+    SearchResult result = searchMcts(enginePointers.data(), threads, pos, budget, stats, &workerPool());
+    if (result.move < 0)
+        result.move = VariantPosition::WIDTH / 2;  // centre par défaut
+    return result;
+}
 
-        int score = -negamax(child, depth - 1, -beta, -alpha, (player == 2 ? 1 : 2));
+// Analyse d'une seule grille sur le thread appelant (indices du joueur)
+template <int Rows, int Cols>
+PositionAnalysis analyzeOnBoard(const Grid& grid, int player, const SearchLimits& limits)
+{
+    using VariantPosition = BasicPosition<Rows, Cols>;
 
-        best = std::max(best, score);
-        alpha = std::max(alpha, score);
+    const VariantPosition pos = gridToPosition<VariantPosition>(grid, player);
+    PositionAnalysis analysis;
+    analyzeBatch(&pos, 1, limits, &analysis, 1, &transpositionTable());
+    return analysis;
+}
 
-        if (alpha >= beta)
-            break;
-    }
+template <int Rows, int Cols>
+bool variantHasAlignment(const Grid& grid, int player)
+{
+    using VariantPosition = BasicPosition<Rows, Cols>;
+    return VariantPosition::hasAlignment(gridToPosition<VariantPosition>(grid, player).current());
+}
+
+// Fenêtres de la case (row, col) (ligne 0 en haut) : 16 au plus, testées sur les pions de sa couleur
+template <int Rows, int Cols>
+bool variantWinsAt(const Grid& grid, int row, int col)
+{
+    using VariantPosition = BasicPosition<Rows, Cols>;
+    if (grid.size() < Rows || grid[0].size() < Cols)
+        return false;
+
+    const VariantPosition pos = gridToPosition<VariantPosition>(grid, grid[row][col]);
+    return WIN_LINES<Rows, Cols>.completes(pos.current(), Rows - 1 - row, col);
+}
+
+// Une seule conversion de la grille pour les deux tests de victoire et l'heuristique
+template <int Rows, int Cols>
+int variantEvaluate(const Grid& grid, int player)
+{
+    using VariantPosition = BasicPosition<Rows, Cols>;
+    const VariantPosition pos = gridToPosition<VariantPosition>(grid, player);
+    if (VariantPosition::hasAlignment(pos.current())) return +WIN_SCORE;
+    if (VariantPosition::hasAlignment(pos.opponent())) return -WIN_SCORE;
+    return SimpleAI::evaluate(pos);
+}
+
+template <int Rows, int Cols>
+constexpr BoardRules rulesFor(SearchResult (*search)(const Grid&, const SearchLimits&, int, SearchMode, SearchStats*))
+{
+    return {Rows, Cols, search, &searchMonteCarlo<Rows, Cols>, &analyzeOnBoard<Rows, Cols>,
+            &variantHasAlignment<Rows, Cols>, &variantWinsAt<Rows, Cols>, &variantEvaluate<Rows, Cols>};
+}
+
+extern const BoardRules STANDARD_RULES = rulesFor<6, 7>(&searchStandard);
+const BoardRules RULES_8X7 = rulesFor<7, 8>(&searchVariant<7, 8>);
+const BoardRules RULES_9X7 = rulesFor<7, 9>(&searchVariant<7, 9>);
 
-    return best;
+std::atomic<const BoardRules*> currentRules{&STANDARD_RULES};
+
+const BoardRules& boardRules()
+{
+    return *currentRules.load();
+}
 }
 
 // ---------------------------------------------------------
-// Recherche du meilleur coup
+// Taille de la grille (choisie une fois pour la partie)
 // ---------------------------------------------------------
-int getBestMove(const Grid& grid, int depth, int robotPlayer)
+bool setBoardSize(int rows, int cols)
 {
-    int bestCol = 3;      // centre par défaut
-    int bestVal = -999999;
-    int humanPlayer = (robotPlayer == 1) ? 2 : 1;  // Adversaire du robot
+    const BoardRules* rules = nullptr;
+    if (rows == 6 && cols == 7)
+        rules = &STANDARD_RULES;
+    else if (rows == 7 && cols == 8)
+        rules = &RULES_8X7;
+    else if (rows == 7 && cols == 9)
+        rules = &RULES_9X7;
+    else
+        return false;
 
-    for (int col = 0; col < 7; col++)
+    if (rules != currentRules.load())
     {
-        if (!isValidMove(grid, col))
-            continue;
-
-        Grid child = playMove(grid, col, robotPlayer);
-        int val = -negamax(child, depth - 1, -100000, 100000, humanPlayer);
-
-        if (val > bestVal)
-        {
-            bestVal = val;
-            bestCol = col;
-        }
+        // Les résultats préparés et la table ne valent que pour l'ancienne grille
+        stopPondering();
+        transpositionTable().clear();
+        currentRules = rules;
     }
+    return true;
+}
+
+int boardRows()
+{
+    return currentRules.load()->rows;
+}
 
-    return bestCol;
+int boardCols()
+{
+    return currentRules.load()->cols;
 }
 }
@@ -1,7 +1,17 @@
 #pragma once
 
 #include <QVector>
+#include <memory>
+#include <string>
+#include "Analysis.hpp"
 #include "CameraAi.hpp"
+#include "Evaluation.hpp"
+#include "NegamaxEngine.hpp"
+#include "NeuralNetwork.hpp"
+#include "OpeningBook.hpp"
+#include "PositionCache.hpp"
+#include "Position.hpp"
+#include "TranspositionTable.hpp"
 
 namespace SimpleAI
 {
@@ -9,20 +19,94 @@ using Grid = CameraAI::Grid;
 
 // Retourne la meilleure colonne à jouer
 // robotPlayer: 1 pour rouge, 2 pour jaune (par défaut 2)
-int getBestMove(const Grid& grid, int depth, int robotPlayer = 2);
+// stats (optionnel) : statistiques de la recherche (positions, coupures, table, variante principale)
+int getBestMove(const Grid& grid, int depth, int robotPlayer = 2, SearchStats* stats = nullptr);
 
-// Optionnel : évalue une grille
+// Moteur de recherche du robot
+enum class SearchMode
+{
+    Negamax,   // approfondissement itératif avec évaluation heuristique
+    Solver,    // jeu parfait : solveur exact, repli sur Negamax s'il n'aboutit pas dans la moitié du budget
+    Mcts       // Monte-Carlo (UCT) sur searchThreads() threads, arbre conservé entre les coups :
+               // force réglée par le temps (budget.maxDepth ignoré), ni bibliothèque ni cache
+};
+
+// Retourne la meilleure colonne trouvée dans le budget (temps / positions / profondeur max)
+// par approfondissement itératif : la latence du tour ne dépend plus de la position
+// budget.stop (optionnel) annule la recherche en quelques millisecondes : le meilleur coup
+// de la dernière itération terminée est retourné (colonne jouable la plus centrale à défaut)
+SearchResult getBestMoveTimed(const Grid& grid, const SearchLimits& budget, int robotPlayer = 2,
+                              SearchMode mode = SearchMode::Negamax, SearchStats* stats = nullptr);
+
+// Réflexion pendant le tour de l'adversaire (grille avec l'adversaire du robot au trait) :
+// getBestMoveTimed() reprend le résultat préparé pour le coup effectivement joué
+void startPondering(const Grid& grid, const SearchLimits& budget, int robotPlayer = 2,
+                    SearchMode mode = SearchMode::Negamax);
+
+// Arrête la réflexion (à appeler dès que le coup de l'adversaire est connu)
+void stopPondering();
+
+// Taille de la grille en lignes, colonnes : 7 x 6 (standard), 8 x 7 ou 9 x 7 (colonnes x lignes).
+// À appeler une fois au début de la partie : choisit la recherche spécialisée pour
+// cette taille (bibliothèque, cache, réflexion et solveur ne servent que sur 7 x 6).
+// Retourne false si la taille n'est pas gérée (la grille courante est conservée).
+bool setBoardSize(int rows, int cols);
+int boardRows();
+int boardCols();
+
+// Table de transposition conservée entre les coups (statistiques lisibles)
+TranspositionTable& transpositionTable();
+
+// Redimensionne la table de transposition (nombre d'éléments, 80 000 000 maximum)
+void setTranspositionTableSize(size_t entries);
+
+// Nombre de threads de recherche de getBestMoveTimed() (Lazy SMP, 1 par défaut).
+// Les threads sont permanents : à appeler avant la première recherche.
+void setSearchThreads(int threads);
+int searchThreads();
+
+// Analyse de plusieurs positions de la grille standard (revue de partie, indices) :
+// score de chaque coup, sur searchThreads() threads qui partagent la table de transposition.
+// Threads permanents distincts de ceux du robot : utilisable pendant la réflexion anticipée.
+void analyzeBatch(const Position* positions, size_t count, const SearchLimits& limits, PositionAnalysis* results);
+
+// Score de chaque colonne d'une grille de la taille courante pour player (au trait),
+// sur le thread appelant avec la table de transposition partagée (indices du joueur)
+PositionAnalysis analyzeGrid(const Grid& grid, int player, const SearchLimits& limits);
+
+// Bibliothèque d'ouvertures consultée avant toute recherche
+// (à charger au démarrage, false si le fichier est absent ou invalide)
+bool loadOpeningBook(const std::string& path);
+const OpeningBook& openingBook();
+
+// Réseau valeur / politique (optionnel, nullptr pour le retirer) : sa politique trie les coups
+// des positions proches de la racine dans les recherches Negamax de la grille standard
+void setNeuralNetwork(std::shared_ptr<NeuralNetwork> network);
+
+// Cache persistant des positions déjà cherchées (créé s'il n'existe pas) :
+// un résultat assez profond est rejoué sans recherche
+bool loadPositionCache(const std::string& path);
+PositionCache& positionCache();
+
+// Convertit une grille caméra (ligne 0 en haut) en bitboard, player étant au trait
+Position toPosition(const Grid& grid, int player);
+
+// Évalue une grille du point de vue du robot (joueur 2) : ±WIN_SCORE si victoire, sinon heuristique
 int evaluate(const Grid& grid);
 
 // Vérifie si un joueur gagne
 bool isWinningMove(const Grid& grid, int player);
 
+// Vérifie si le pion en (row, col) (ligne 0 en haut) complète un alignement de sa couleur :
+// seules les fenêtres de 4 cases passant par cette case sont testées (dernier pion posé)
+bool isWinningMoveAt(const Grid& grid, int row, int col);
+
 // Vérifie si un coup est jouable
 bool isValidMove(const Grid& grid, int col);
 
 // Joue un coup dans une copie de la grille
 Grid playMove(const Grid& grid, int col, int player);
 
-// Negamax avec élagage alpha-beta
+// Negamax avec élagage alpha-beta (score du point de vue de player)
 int negamax(const Grid& grid, int depth, int alpha, int beta, int player);
 }
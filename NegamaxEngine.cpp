@@ -0,0 +1,629 @@
+#include "NegamaxEngine.hpp"
+#include "Evaluation.hpp"
+#include "MovePriors.hpp"
+#include <algorithm>
+#include <initializer_list>
+#include <thread>
+#include <vector>
+
+namespace SimpleAI
+{
+namespace
+{
+// Score du joueur au trait s'il gagne au prochain coup
+template <class Position>
+inline int winScore(const Position& pos)
+{
+    return WIN_SCORE + (Position::CELLS - pos.nbMoves());
+}
+
+// Le budget n'est vérifié que toutes les CHECK_INTERVAL positions
+constexpr uint64_t CHECK_INTERVAL = 4096;
+
+// Fenêtre d'aspiration : demi-largeur initiale (unités de l'évaluation, une menace vaut 8 à 16)
+// et première profondeur où elle s'applique (avant, le score de l'itération précédente est trop instable)
+constexpr int ASPIRATION_WINDOW = 32;
+constexpr int ASPIRATION_MIN_DEPTH = 5;
+
+// Priorités de tri : coup TT/PV > killers > menaces créées (ou politique du réseau) > historique > centre
+constexpr uint32_t FIRST_MOVE_BONUS = 1u << 30;
+constexpr uint32_t KILLER_BONUS = 1u << 28;
+constexpr int THREAT_SHIFT = 20;
+constexpr uint32_t HISTORY_MAX = (1u << THREAT_SHIFT) - 1;
+
+template <class Position>
+inline int cellIndex(const Position& pos, int col)
+{
+    return col * (Position::HEIGHT + 1) + pos.height(col);
+}
+}
+
+template <int Rows, int Cols>
+BasicNegamaxEngine<Rows, Cols>::BasicNegamaxEngine(TranspositionTable* tt, const SearchOptions& options)
+    : tt_(tt), options_(options)
+{
+    resetOrdering();
+}
+
+// ---------------------------------------------------------
+// Ordonnancement des coups
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+void BasicNegamaxEngine<Rows, Cols>::resetOrdering()
+{
+    for (auto& k : killers_)
+        std::fill(std::begin(k), std::end(k), int8_t(-1));
+    for (auto& h : history_)
+        std::fill(std::begin(h), std::end(h), 0u);
+}
+
+template <int Rows, int Cols>
+int BasicNegamaxEngine<Rows, Cols>::orderMoves(const Position& pos, Bitboard allowed, int firstMove,
+                                               int moves[Position::WIDTH]) const
+{
+    int count = 0;
+
+    if (!options_.moveOrdering)
+    {
+        for (int col = 0; col < Position::WIDTH; col++)
+        {
+            if (allowed & Position::columnMask(col))
+                moves[count++] = col;
+        }
+        return count;
+    }
+
+    uint32_t priority[Position::WIDTH];
+    const int side = pos.nbMoves() & 1;
+    const int8_t* killers = killers_[pos.nbMoves()];
+    const uint8_t* policy = options_.priors ? options_.priors->find(pos.key(), pos.nbMoves()) : nullptr;
+
+    for (int i = 0; i < Position::WIDTH; i++)
+    {
+        const int col = Position::CENTER_ORDER[i];
+        if (!(allowed & Position::columnMask(col)))
+            continue;
+
+        // Politique quantifiée sur 0..255 : reste sous KILLER_BONUS une fois décalée
+        uint32_t p = (uint32_t(policy ? policy[col] : pos.threatsAfter(col)) << THREAT_SHIFT)
+                   + history_[side][cellIndex(pos, col)];
+        if (col == firstMove)
+            p = FIRST_MOVE_BONUS;
+        else if (col == killers[0])
+            p = KILLER_BONUS + 1;
+        else if (col == killers[1])
+            p = KILLER_BONUS;
+
+        // Tri par insertion stable : à priorité égale l'ordre centre d'abord est conservé
+        int j = count++;
+        while (j > 0 && priority[j - 1] < p)
+        {
+            moves[j] = moves[j - 1];
+            priority[j] = priority[j - 1];
+            j--;
+        }
+        moves[j] = col;
+        priority[j] = p;
+    }
+
+    return count;
+}
+
+template <int Rows, int Cols>
+void BasicNegamaxEngine<Rows, Cols>::recordCutoff(const Position& pos, int col, int depth)
+{
+    int8_t* killers = killers_[pos.nbMoves()];
+    if (killers[0] != col)
+    {
+        killers[1] = killers[0];
+        killers[0] = static_cast<int8_t>(col);
+    }
+
+    uint32_t& h = history_[pos.nbMoves() & 1][cellIndex(pos, col)];
+    h = std::min<uint32_t>(HISTORY_MAX, h + uint32_t(depth * depth));
+}
+
+// ---------------------------------------------------------
+// Statistiques
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+void BasicNegamaxEngine<Rows, Cols>::resetStats()
+{
+    stats_ = SearchStats();
+    start_ = std::chrono::steady_clock::now();
+}
+
+template <int Rows, int Cols>
+void BasicNegamaxEngine<Rows, Cols>::recordIteration(const Position& pos, int depth, int move, int score)
+{
+    const auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+
+    stats_.nodes = nodes_;
+    stats_.depth = depth;
+    stats_.time = elapsed;
+    if (stats_.iterationCount < Position::CELLS)
+        stats_.iterations[stats_.iterationCount++] = {depth, move, score, nodes_, elapsed};
+
+    // Variante principale : coup de la racine puis coups mémorisés dans la table
+    stats_.pvLength = 0;
+    Position p = pos;
+    int col = move;
+    while (col >= 0 && col < Position::WIDTH && p.canPlay(col) && stats_.pvLength < depth)
+    {
+        stats_.pv[stats_.pvLength++] = static_cast<int8_t>(col);
+        if (p.isWinningMove(col))
+            break;
+        p.play(col);
+
+        col = ttMove(p);
+    }
+}
+
+// ---------------------------------------------------------
+// Coup mémorisé dans la table (clé canonique, colonne ramenée à la position)
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+int BasicNegamaxEngine<Rows, Cols>::ttMove(const Position& pos) const
+{
+    bool mirrored = false;
+    TranspositionTable::Entry entry;
+    if (!tt_ || !tt_->get(pos.canonicalKey(mirrored), entry) || entry.move < 0)
+        return -1;
+    return mirrored ? Position::mirrorColumn(entry.move) : entry.move;
+}
+
+// ---------------------------------------------------------
+// Contrôle du budget (temps / nombre de positions)
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+bool BasicNegamaxEngine<Rows, Cols>::outOfBudget()
+{
+    if (aborted_)
+        return true;
+    if (!limited_ || (nodes_ % CHECK_INTERVAL) != 0)
+        return false;
+
+    if (stop_ && stop_->load(std::memory_order_relaxed))
+        aborted_ = true;
+    else if (cancel_ && cancel_->load(std::memory_order_relaxed))
+        aborted_ = true;
+    else if (nodeLimit_ > 0 && nodes_ >= nodeLimit_)
+        aborted_ = true;
+    else if (std::chrono::steady_clock::now() >= deadline_)
+        aborted_ = true;
+
+    return aborted_;
+}
+
+// ---------------------------------------------------------
+// Negamax récursif
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+int BasicNegamaxEngine<Rows, Cols>::negamax(Position& pos, int depth, int alpha, int beta)
+{
+    nodes_++;
+    if (outOfBudget())
+        return 0;  // résultat ignoré par l'appelant
+
+    if (pos.nbMoves() == Position::CELLS)
+        return 0;  // grille pleine : égalité
+
+    // Victoire immédiate du joueur au trait
+    for (int col = 0; col < Position::WIDTH; col++)
+    {
+        if (pos.canPlay(col) && pos.isWinningMove(col))
+            return winScore(pos);
+    }
+
+    if (depth == 0)
+        return options_.heuristicEval ? evaluate(pos) : 0;
+
+    // Les coups qui laissent une victoire immédiate à l'adversaire ne sont pas explorés
+    const Bitboard next = pos.possibleNonLosingMoves();
+    if (!next)
+        return -winScore(pos) + 1;  // l'adversaire gagne au coup suivant quoi qu'on joue
+
+    // Table de transposition : la position a-t-elle déjà été cherchée assez profond ?
+    // Une position et sa symétrique partagent la même entrée (coups mémorisés côté clé canonique)
+    const int alphaOrig = alpha;
+    bool mirrored = false;
+    const uint64_t key = pos.canonicalKey(mirrored);
+    int ttMove = -1;
+    if (tt_)
+    {
+        TranspositionTable::Entry entry;
+        stats_.ttProbes++;
+        if (tt_->get(key, entry))
+        {
+            stats_.ttHits++;
+            if (entry.move >= 0)
+                ttMove = mirrored ? Position::mirrorColumn(entry.move) : entry.move;
+            if (entry.depth >= depth)
+            {
+                if (entry.bound == TranspositionTable::Exact)
+                    return entry.score;
+                if (entry.bound == TranspositionTable::Lower)
+                    alpha = std::max(alpha, int(entry.score));
+                else if (entry.bound == TranspositionTable::Upper)
+                    beta = std::min(beta, int(entry.score));
+                if (alpha >= beta)
+                    return entry.score;
+            }
+        }
+    }
+
+    int moves[Position::WIDTH];
+    const int count = orderMoves(pos, next, ttMove, moves);
+
+    int best = -INF_SCORE;
+    int bestCol = -1;
+
+    for (int i = 0; i < count; i++)
+    {
+        const int col = moves[i];
+        pos.play(col);
+        int score;
+        if (i == 0 || !options_.pvs)
+            score = -negamax(pos, depth - 1, -beta, -alpha);
+        else
+        {
+            // PVS : le premier coup est supposé le meilleur, les suivants sont seulement
+            // réfutés à fenêtre nulle, et recherchés en entier s'ils le dépassent
+            score = -negamax(pos, depth - 1, -alpha - 1, -alpha);
+            if (score > alpha && score < beta && !aborted_)
+                score = -negamax(pos, depth - 1, -beta, -alpha);
+        }
+        pos.undo(col);
+        if (aborted_)
+            return 0;
+
+        if (score > best)
+        {
+            best = score;
+            bestCol = col;
+        }
+        alpha = std::max(alpha, score);
+
+        if (alpha >= beta)
+        {
+            stats_.betaCutoffs++;
+            stats_.cutoffsAtMove[i]++;
+            if (options_.moveOrdering)
+                recordCutoff(pos, col, depth);
+            break;
+        }
+    }
+
+    if (tt_)
+    {
+        TranspositionTable::Bound bound = TranspositionTable::Exact;
+        if (best <= alphaOrig)
+            bound = TranspositionTable::Upper;
+        else if (best >= beta)
+            bound = TranspositionTable::Lower;
+        const int storedCol = (mirrored && bestCol >= 0) ? Position::mirrorColumn(bestCol) : bestCol;
+        tt_->put(key, best, depth, bound, storedCol);
+    }
+
+    return best;
+}
+
+// ---------------------------------------------------------
+// Passe tactique avant la recherche
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+bool BasicNegamaxEngine<Rows, Cols>::forcedMove(const Position& pos, int& move, int& score)
+{
+    const Bitboard possible = pos.possible();
+    if (!possible)
+        return false;
+
+    // Victoire immédiate
+    const Bitboard wins = Position::winningCells(pos.current()) & possible;
+    // Sinon : parade obligatoire et coups qui ne jouent pas sous une menace adverse
+    const Bitboard safe = wins ? wins : pos.possibleNonLosingMoves();
+    const Bitboard candidates = safe ? safe : possible;
+
+    // Plus d'un coup sûr : la recherche complète décide (sur ces seuls coups)
+    if (!wins && safe && popcount(safe) > 1)
+        return false;
+
+    for (int col : Position::CENTER_ORDER)
+    {
+        if (candidates & Position::columnMask(col))
+        {
+            move = col;
+            break;
+        }
+    }
+
+    nodes_++;
+    stats_.source = SearchSource::Tactic;
+    if (wins)
+        score = winScore(pos);
+    else if (!safe)
+        score = -winScore(pos) + 1;  // défaite au coup suivant quoi qu'on joue
+    else
+    {
+        // Parade unique : score statique de la position obtenue
+        Position child = pos;
+        child.play(move);
+        score = options_.heuristicEval ? -evaluate(child) : 0;
+    }
+    return true;
+}
+
+// ---------------------------------------------------------
+// Recherche à la racine
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+int BasicNegamaxEngine<Rows, Cols>::searchRoot(const Position& pos, int depth, int firstMove, int alpha, int beta,
+                                               int& bestScore)
+{
+    int bestCol = -1;
+    int bestVal = -INF_SCORE;
+
+    // Ordre : firstMove (meilleur coup de l'itération précédente, sinon coup TT) puis les autres
+    if (firstMove < 0)
+        firstMove = ttMove(pos);
+
+    // Coups sûrs uniquement (forcedMove() a déjà traité les victoires immédiates et les défaites inévitables)
+    Bitboard allowed = pos.possibleNonLosingMoves();
+    if (!allowed)
+        allowed = pos.possible();
+
+    int moves[Position::WIDTH];
+    const int count = orderMoves(pos, allowed, firstMove, moves);
+
+    for (int i = 0; i < count; i++)
+    {
+        const int col = moves[i];
+
+        if (pos.isWinningMove(col))
+        {
+            bestCol = col;
+            bestVal = winScore(pos);
+            break;
+        }
+
+        Position child = pos;
+        child.play(col);
+        int val;
+        if (bestCol < 0)
+            val = -negamax(child, depth - 1, -beta, -alpha);
+        else if (options_.pvs)
+        {
+            // Fenêtre nulle au-dessus du meilleur score, recherche complète seulement s'il est battu
+            val = -negamax(child, depth - 1, -alpha - 1, -alpha);
+            if (val > alpha && val < beta && !aborted_)
+                val = -negamax(child, depth - 1, -beta, -alpha);
+        }
+        else
+        {
+            // Fenêtre (alpha, beta) : un coup moins bon est réfuté dès la première réponse suffisante
+            val = -negamax(child, depth - 1, -beta, -alpha);
+        }
+        if (aborted_)
+            break;
+
+        if (bestCol < 0 || val > bestVal)
+        {
+            bestVal = val;
+            bestCol = col;
+        }
+        alpha = std::max(alpha, val);
+        if (alpha >= beta)
+            break;  // échec haut de la fenêtre d'aspiration
+    }
+
+    bestScore = bestVal;
+    return bestCol;
+}
+
+// ---------------------------------------------------------
+// Recherche du meilleur coup à profondeur fixe
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+int BasicNegamaxEngine<Rows, Cols>::bestMove(const Position& pos, int depth, int* bestScore)
+{
+    nodes_ = 0;
+    limited_ = false;
+    aborted_ = false;
+    resetOrdering();
+    resetStats();
+
+    int score = 0;
+    int bestCol = -1;
+    if (forcedMove(pos, bestCol, score))
+        recordIteration(pos, 1, bestCol, score);
+    else
+    {
+        bestCol = searchRoot(pos, depth, -1, -INF_SCORE, INF_SCORE, score);
+        recordIteration(pos, depth, bestCol, score);
+    }
+
+    if (bestScore)
+        *bestScore = score;
+    return bestCol;
+}
+
+// ---------------------------------------------------------
+// Approfondissement itératif avec budget
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+SearchResult BasicNegamaxEngine<Rows, Cols>::search(const Position& pos, const SearchLimits& limits)
+{
+    nodes_ = 0;
+    aborted_ = false;
+    resetOrdering();
+    resetStats();
+    cancel_ = limits.stop;
+    limited_ = limits.time.count() > 0 || limits.nodes > 0 || stop_ != nullptr || cancel_ != nullptr;
+    nodeLimit_ = limits.nodes;
+    deadline_ = limits.time.count() > 0
+        ? std::chrono::steady_clock::now() + limits.time
+        : std::chrono::steady_clock::time_point::max();
+
+    SearchResult result;
+
+    // Coup de secours si même la profondeur 1 n'a pas le temps de finir
+    for (int col : Position::CENTER_ORDER)
+    {
+        if (pos.canPlay(col))
+        {
+            result.move = col;
+            break;
+        }
+    }
+    if (result.move < 0)
+        return result;
+
+    // Position tactique : réponse immédiate, sans approfondissement
+    if (forcedMove(pos, result.move, result.score))
+    {
+        result.depth = 1;
+        recordIteration(pos, 1, result.move, result.score);
+        result.nodes = nodes_;
+        stats_.nodes = nodes_;
+        stats_.time = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - start_);
+        return result;
+    }
+
+    const int maxDepth = std::min(limits.maxDepth, Position::CELLS - pos.nbMoves());
+
+    for (int depth = std::max(1, limits.minDepth); depth <= maxDepth; depth++)
+    {
+        int score = 0;
+        int col = -1;
+
+        // Fenêtre d'aspiration centrée sur le score précédent, élargie (doublée) du côté
+        // qui a échoué jusqu'à encadrer le score ; fenêtre complète au début et pour un score de fin
+        int delta = ASPIRATION_WINDOW;
+        int alpha = -INF_SCORE;
+        int beta = INF_SCORE;
+        if (options_.aspiration && depth >= ASPIRATION_MIN_DEPTH && result.depth > 0)
+        {
+            alpha = std::max(-INF_SCORE, result.score - delta);
+            beta = std::min(INF_SCORE, result.score + delta);
+        }
+
+        for (;;)
+        {
+            // Première itération : coup de la table de transposition s'il existe
+            col = searchRoot(pos, depth, result.depth > 0 ? result.move : -1, alpha, beta, score);
+            if (aborted_)
+                break;
+
+            if (score <= alpha && alpha > -INF_SCORE)
+                alpha = (score <= -WIN_SCORE) ? -INF_SCORE : std::max(-INF_SCORE, score - (delta *= 2));
+            else if (score >= beta && beta < INF_SCORE)
+                beta = (score >= WIN_SCORE) ? INF_SCORE : std::min(INF_SCORE, score + (delta *= 2));
+            else
+                break;
+        }
+        if (aborted_)
+            break;
+
+        result.move = col;
+        result.score = score;
+        result.depth = depth;
+        recordIteration(pos, depth, col, score);
+
+        // Victoire ou défaite forcée trouvée : inutile d'approfondir
+        if (score >= WIN_SCORE || score <= -WIN_SCORE)
+            break;
+    }
+
+    result.nodes = nodes_;
+    stats_.nodes = nodes_;
+    stats_.time = std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now() - start_);
+    return result;
+}
+
+// ---------------------------------------------------------
+// Recherche parallèle Lazy SMP
+// ---------------------------------------------------------
+template <int Rows, int Cols>
+SearchResult searchParallel(const BasicPosition<Rows, Cols>& pos, const SearchLimits& limits, int threads,
+                            TranspositionTable* tt, const SearchOptions& options, SearchStats* stats,
+                            WorkerPool* pool)
+{
+    using Engine = BasicNegamaxEngine<Rows, Cols>;
+
+    if (threads <= 1 || !tt)
+    {
+        Engine engine(tt, options);
+        SearchResult result = engine.search(pos, limits);
+        if (stats)
+            *stats = engine.stats();
+        return result;
+    }
+
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> helperNodes(threads - 1, 0);
+    std::vector<std::thread> helpers;
+    std::vector<std::future<void>> pooled;
+    if (pool)
+        pooled.reserve(threads - 1);
+    else
+        helpers.reserve(threads - 1);
+
+    for (int i = 1; i < threads; i++)
+    {
+        auto helperSearch = [&, i]() {
+            Engine helper(tt, options);
+            helper.setStopFlag(&stop);
+
+            // Un thread sur deux saute une profondeur : les threads ne cherchent pas tous la même itération
+            SearchLimits helperLimits;
+            helperLimits.minDepth = limits.minDepth + (i % 2);
+            helperLimits.maxDepth = limits.maxDepth;
+            helperLimits.stop = limits.stop;
+            helper.search(pos, helperLimits);
+
+            helperNodes[i - 1] = helper.nodes();
+        };
+
+        if (pool)
+            pooled.push_back(pool->submit(helperSearch));
+        else
+            helpers.emplace_back(helperSearch);
+    }
+
+    Engine engine(tt, options);
+    SearchResult result = engine.search(pos, limits);
+
+    stop.store(true, std::memory_order_relaxed);
+    for (std::thread& t : helpers)
+        t.join();
+    for (std::future<void>& f : pooled)
+        f.wait();
+
+    for (uint64_t n : helperNodes)
+        result.nodes += n;
+
+    if (stats)
+    {
+        *stats = engine.stats();
+        stats->nodes = result.nodes;
+    }
+    return result;
+}
+
+// ---------------------------------------------------------
+// Grilles gérées : 7 x 6 (standard), 8 x 7, 9 x 7
+// ---------------------------------------------------------
+template class BasicNegamaxEngine<6, 7>;
+template class BasicNegamaxEngine<7, 8>;
+template class BasicNegamaxEngine<7, 9>;
+
+template SearchResult searchParallel(const BasicPosition<6, 7>&, const SearchLimits&, int,
+                                     TranspositionTable*, const SearchOptions&, SearchStats*, WorkerPool*);
+template SearchResult searchParallel(const BasicPosition<7, 8>&, const SearchLimits&, int,
+                                     TranspositionTable*, const SearchOptions&, SearchStats*, WorkerPool*);
+template SearchResult searchParallel(const BasicPosition<7, 9>&, const SearchLimits&, int,
+                                     TranspositionTable*, const SearchOptions&, SearchStats*, WorkerPool*);
+}
@@ -0,0 +1,204 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "Position.hpp"
+#include "TranspositionTable.hpp"
+#include "WorkerPool.hpp"
+
+namespace SimpleAI
+{
+class MovePriors;
+
+// Score d'une victoire (augmenté du nombre de cases restantes pour préférer les victoires rapides)
+constexpr int WIN_SCORE = 10000;
+constexpr int INF_SCORE = 100000;
+
+// Version de l'évaluation et de l'échelle des scores, à incrémenter à chaque changement :
+// les résultats du cache persistant produits par une autre version sont effacés
+constexpr uint32_t ENGINE_VERSION = 1;
+
+// Budget d'une recherche par approfondissement itératif
+struct SearchLimits
+{
+    int minDepth = 1;                        // profondeur de la première itération
+    int maxDepth = MAX_CELLS;                // profondeur maximale (limitée aux cases restantes)
+    std::chrono::milliseconds time{0};       // temps de réflexion (0 = illimité)
+    uint64_t nodes = 0;                      // nombre de positions (0 = illimité)
+
+    // Jeton d'arrêt coopératif (optionnel, non possédé) : consulté toutes les quelques milliers
+    // de positions, la recherche rend alors le meilleur coup de la dernière itération terminée
+    const std::atomic<bool>* stop = nullptr;
+};
+
+// Résultat de la dernière itération complète
+struct SearchResult
+{
+    int move = -1;        // meilleure colonne (-1 si la grille est pleine)
+    int score = 0;        // score du point de vue du joueur au trait
+    int depth = 0;        // profondeur de la dernière itération terminée
+    uint64_t nodes = 0;   // positions visitées au total
+};
+
+// Origine du coup retourné par SimpleAI::getBestMove() / getBestMoveTimed()
+enum class SearchSource
+{
+    Search,    // recherche Negamax
+    Book,      // bibliothèque d'ouvertures
+    Cache,     // cache persistant des positions
+    Ponder,    // préparé pendant le tour de l'adversaire
+    Solver,    // solveur exact
+    Tactic,    // coup forcé (victoire immédiate, parade unique, défaite inévitable), sans recherche
+    Mcts       // recherche Monte-Carlo (nodes = playouts, depth = profondeur maximale de l'arbre)
+};
+
+// Statistiques d'une recherche (thread principal), remplies sans allocation
+struct SearchStats
+{
+    struct Iteration
+    {
+        int depth = 0;
+        int move = -1;
+        int score = 0;
+        uint64_t nodes = 0;                    // positions cumulées à la fin de l'itération
+        std::chrono::microseconds time{0};     // temps cumulé à la fin de l'itération
+    };
+
+    SearchSource source = SearchSource::Search;
+    uint64_t nodes = 0;
+    uint64_t betaCutoffs = 0;
+    uint64_t cutoffsAtMove[MAX_WIDTH] = {};    // coupures selon le rang du coup dans l'ordre d'exploration
+    uint64_t ttProbes = 0;
+    uint64_t ttHits = 0;
+    int depth = 0;                             // profondeur de la dernière itération terminée
+    std::chrono::microseconds time{0};         // durée totale
+
+    int8_t pv[MAX_CELLS] = {};                 // variante principale (colonnes)
+    int pvLength = 0;
+
+    Iteration iterations[MAX_CELLS];
+    int iterationCount = 0;
+};
+
+// Options de la recherche (permettent de mesurer l'apport de chaque heuristique)
+struct SearchOptions
+{
+    bool moveOrdering = true;   // centre d'abord, coup TT, coups killers, historique
+    bool heuristicEval = true;  // évaluation des feuilles (sinon 0 hors victoire)
+    bool pvs = true;            // recherche à fenêtre nulle des coups après le premier (racine et nœuds)
+    bool aspiration = true;     // fenêtre d'aspiration autour du score de l'itération précédente
+
+    // Politique du réseau des positions proches de la racine (optionnelle, non possédée,
+    // lue par tous les threads) : remplace le nombre de menaces dans le tri de ces positions
+    const MovePriors* priors = nullptr;
+};
+
+// =============================================================
+//   MOTEUR NEGAMAX SUR BITBOARD
+// =============================================================
+// Aucune dépendance à Qt : la conversion depuis CameraAI::Grid
+// est faite une seule fois dans SimpleAI::getBestMove().
+// Une version par taille de grille (instanciée dans NegamaxEngine.cpp
+// pour 7 x 6, 8 x 7 et 9 x 7), toutes les dimensions sont constantes.
+template <int Rows, int Cols>
+class BasicNegamaxEngine
+{
+public:
+    using Position = BasicPosition<Rows, Cols>;
+    using Bitboard = typename Position::Bitboard;
+
+    // tt (optionnel, non possédée) : table de transposition conservée entre les recherches
+    explicit BasicNegamaxEngine(TranspositionTable* tt = nullptr,
+                                const SearchOptions& options = SearchOptions());
+
+    // Retourne la meilleure colonne pour le joueur au trait (-1 si la grille est pleine)
+    // bestScore (optionnel) reçoit le score du point de vue du joueur au trait
+    int bestMove(const Position& pos, int depth, int* bestScore = nullptr);
+
+    // Approfondissement itératif (1, 2, 3...) jusqu'à épuisement du budget :
+    // le meilleur coup d'une itération est cherché en premier à la suivante
+    // et le résultat de la dernière itération terminée est retourné.
+    // Une position tactique (victoire immédiate, parade unique, défaite inévitable)
+    // est jouée sans recherche ; sinon seuls les coups sûrs sont explorés.
+    SearchResult search(const Position& pos, const SearchLimits& limits);
+
+    // Negamax avec élagage alpha-beta, score du point de vue du joueur au trait
+    // pos est jouée / annulée en place pendant la recherche et restituée à l'identique
+    int negamax(Position& pos, int depth, int alpha, int beta);
+
+    // Nombre de positions visitées depuis le dernier bestMove() / search()
+    uint64_t nodes() const { return nodes_; }
+
+    // Statistiques du dernier bestMove() / search()
+    const SearchStats& stats() const { return stats_; }
+
+    // Drapeau d'arrêt partagé (optionnel, non possédé) : search() s'interrompt dès qu'il passe à true
+    void setStopFlag(const std::atomic<bool>* stop) { stop_ = stop; }
+
+private:
+    // Recherche à la racine dans la fenêtre (alpha, beta), firstMove (si jouable) est exploré en premier.
+    // bestScore <= alpha ou >= beta : échec de la fenêtre, le score n'est qu'une borne
+    int searchRoot(const Position& pos, int depth, int firstMove, int alpha, int beta, int& bestScore);
+
+    // Vérifie périodiquement le budget, positionne aborted_ s'il est dépassé
+    bool outOfBudget();
+
+    // Coup mémorisé dans la table pour cette position (-1 si absent)
+    int ttMove(const Position& pos) const;
+
+    // Coup forcé sans recherche : victoire immédiate, unique coup sûr (parade) ou défaite inévitable
+    bool forcedMove(const Position& pos, int& move, int& score);
+
+    // Remplit moves avec les colonnes de allowed dans l'ordre d'exploration, retourne leur nombre
+    int orderMoves(const Position& pos, Bitboard allowed, int firstMove, int moves[Position::WIDTH]) const;
+
+    // Mise à jour des killers et de l'historique après une coupure beta
+    void recordCutoff(const Position& pos, int col, int depth);
+
+    // Efface killers et historique (début de recherche)
+    void resetOrdering();
+
+    // Début d'une recherche : compteurs à zéro
+    void resetStats();
+
+    // Fin d'une itération : temps, positions et variante principale (suivie dans la table)
+    void recordIteration(const Position& pos, int depth, int move, int score);
+
+    TranspositionTable* tt_ = nullptr;
+    SearchOptions options_;
+    uint64_t nodes_ = 0;
+    SearchStats stats_;
+    std::chrono::steady_clock::time_point start_;
+
+    // Deux coups killers par nombre de pions joués, historique par (joueur, case)
+    static constexpr int KILLERS = 2;
+    static constexpr int BOARD_BITS = Position::WIDTH * (Position::HEIGHT + 1);
+    int8_t killers_[Position::CELLS + 1][KILLERS];
+    uint32_t history_[2][BOARD_BITS];
+
+    // Budget de la recherche en cours
+    bool limited_ = false;
+    bool aborted_ = false;
+    std::chrono::steady_clock::time_point deadline_;
+    uint64_t nodeLimit_ = 0;
+    const std::atomic<bool>* stop_ = nullptr;
+    const std::atomic<bool>* cancel_ = nullptr;   // SearchLimits::stop de la recherche en cours
+};
+
+// Recherche Lazy SMP : threads moteurs indépendants qui partagent la table de transposition
+// (obligatoire, sinon la recherche reste sur un seul thread). Les threads auxiliaires
+// commencent à des profondeurs décalées pour explorer d'autres branches et remplir la table ;
+// seul le thread principal respecte le budget et fournit le résultat, si bien qu'avec
+// threads = 1 le résultat est strictement identique à NegamaxEngine::search().
+// stats (optionnel) : statistiques du thread principal, positions de tous les threads
+// pool (optionnel, non possédé) : les threads auxiliaires sont pris dans ce groupe permanent
+// (au moins threads - 1 threads libres) au lieu d'être créés pour la recherche
+template <int Rows, int Cols>
+SearchResult searchParallel(const BasicPosition<Rows, Cols>& pos, const SearchLimits& limits, int threads,
+                            TranspositionTable* tt, const SearchOptions& options = SearchOptions(),
+                            SearchStats* stats = nullptr, WorkerPool* pool = nullptr);
+
+// Moteur de la grille standard
+using NegamaxEngine = BasicNegamaxEngine<6, 7>;
+}
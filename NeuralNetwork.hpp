@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// Sortie du réseau pour une position, du point de vue du joueur au trait
+struct NetworkOutput
+{
+    float value = 0.0f;                   // espérance du résultat, de -1 (défaite) à +1 (victoire)
+    float policy[Position::WIDTH] = {};   // probabilité de chaque colonne (0 si injouable), somme 1
+};
+
+// =============================================================
+//   RÉSEAU VALEUR / POLITIQUE (grille standard)
+// =============================================================
+// Interface sans dépendance : le moteur ne connaît ni libtorch ni le format
+// du modèle (implémentation TorchScript dans TorchNetwork.hpp).
+// Les positions sont évaluées par lots : un appel à evaluate() coûte presque
+// autant pour une position que pour maxBatch(), les recherches regroupent donc
+// leurs feuilles avant de l'appeler.
+// Une instance n'est utilisée que par un thread à la fois.
+class NeuralNetwork
+{
+public:
+    // Entrée du modèle : 2 plans HEIGHT x WIDTH (pions du joueur au trait, pions de l'adversaire),
+    // ligne 0 en bas, 1.0 pour une case occupée
+    static constexpr int PLANES = 2;
+    static constexpr int INPUT_SIZE = PLANES * Position::HEIGHT * Position::WIDTH;
+
+    virtual ~NeuralNetwork() = default;
+
+    // Nombre maximal de positions par appel à evaluate()
+    virtual int maxBatch() const = 0;
+
+    // Évalue count positions (1 <= count <= maxBatch()) en un seul passage du réseau
+    virtual void evaluate(const Position* positions, int count, NetworkOutput* outputs) = 0;
+
+    // Remplit input (INPUT_SIZE valeurs) avec l'encodage de pos
+    static void encode(const Position& pos, float* input)
+    {
+        const Position::Bitboard own = pos.current();
+        const Position::Bitboard other = pos.opponent();
+        for (int row = 0; row < Position::HEIGHT; row++)
+        {
+            for (int col = 0; col < Position::WIDTH; col++)
+            {
+                const Position::Bitboard cell = Position::cellMask(row, col);
+                const int i = row * Position::WIDTH + col;
+                input[i] = (own & cell) ? 1.0f : 0.0f;
+                input[Position::CELLS + i] = (other & cell) ? 1.0f : 0.0f;
+            }
+        }
+    }
+};
+}
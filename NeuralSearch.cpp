@@ -0,0 +1,244 @@
+#include "NeuralSearch.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+
+namespace SimpleAI
+{
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Score du joueur au trait s'il gagne au prochain coup (même échelle que NegamaxEngine)
+inline int winScore(const Position& pos)
+{
+    return WIN_SCORE + (Position::CELLS - pos.nbMoves());
+}
+
+// Évalue positions[0..count) par lots, false si le budget est épuisé avant la fin
+template <class StopCheck>
+bool evaluateBatches(NeuralNetwork& net, const Position* positions, size_t count,
+                     std::vector<NetworkOutput>& outputs, StopCheck outOfBudget)
+{
+    outputs.resize(count);
+    const size_t batch = static_cast<size_t>(std::max(1, net.maxBatch()));
+    for (size_t first = 0; first < count; first += batch)
+    {
+        if (outOfBudget())
+            return false;
+        net.evaluate(positions + first, static_cast<int>(std::min(batch, count - first)), outputs.data() + first);
+    }
+    return true;
+}
+
+// ---------------------------------------------------------
+// Arbre à pleine largeur parcouru deux fois dans le même ordre :
+// collecte des feuilles, puis remontée des scores une fois le réseau passé
+// ---------------------------------------------------------
+class FullWidthTree
+{
+public:
+    // Première passe : feuilles (positions non terminales à la profondeur limite)
+    void collect(Position& pos, int depth)
+    {
+        leaves_.clear();
+        visit(pos, depth, true);
+    }
+
+    const std::vector<Position>& leaves() const { return leaves_; }
+
+    // Deuxième passe : score de chaque coup de la racine (INVALID_MOVE_SCORE sinon)
+    int backup(Position& pos, int depth, const std::vector<NetworkOutput>& values, int scores[Position::WIDTH])
+    {
+        values_ = &values;
+        next_ = 0;
+        std::fill(scores, scores + Position::WIDTH, -INF_SCORE);
+
+        int best = -1;
+        int bestScore = -INF_SCORE;
+        if (pos.canWinNext() || !pos.possibleNonLosingMoves())
+        {
+            // Position de départ tactique : le premier coup sûr ou gagnant suffit
+            for (int col : Position::CENTER_ORDER)
+            {
+                if (pos.canPlay(col) && (best < 0 || pos.isWinningMove(col)))
+                    best = col;
+            }
+            scores[best] = visit(pos, depth, false);
+            return best;
+        }
+
+        const Position::Bitboard moves = pos.possibleNonLosingMoves();
+        for (int col : Position::CENTER_ORDER)
+        {
+            if (!(moves & Position::columnMask(col)))
+                continue;
+            pos.play(col);
+            scores[col] = -visit(pos, depth - 1, false);
+            pos.undo(col);
+            if (scores[col] > bestScore)
+            {
+                bestScore = scores[col];
+                best = col;
+            }
+        }
+        return best;
+    }
+
+private:
+    int visit(Position& pos, int depth, bool collecting)
+    {
+        if (pos.nbMoves() >= Position::CELLS)
+            return 0;
+        if (pos.canWinNext())
+            return winScore(pos);
+
+        const Position::Bitboard moves = pos.possibleNonLosingMoves();
+        if (!moves)
+            return -winScore(pos) + 1;  // l'adversaire gagne au coup suivant
+        if (pos.nbMoves() >= Position::CELLS - 2)
+            return 0;                   // deux derniers coups sans alignement possible
+
+        if (depth <= 0)
+        {
+            if (collecting)
+            {
+                leaves_.push_back(pos);
+                return 0;
+            }
+            const float value = (*values_)[next_++].value;
+            return static_cast<int>(std::lround(std::max(-1.0f, std::min(1.0f, value)) * NEURAL_SCORE));
+        }
+
+        int best = -INF_SCORE;
+        for (int col : Position::CENTER_ORDER)
+        {
+            if (!(moves & Position::columnMask(col)))
+                continue;
+            pos.play(col);
+            best = std::max(best, -visit(pos, depth - 1, collecting));
+            pos.undo(col);
+        }
+        return best;
+    }
+
+    std::vector<Position> leaves_;
+    const std::vector<NetworkOutput>* values_ = nullptr;
+    size_t next_ = 0;
+};
+}
+
+// ---------------------------------------------------------
+// Politique des positions proches de la racine
+// ---------------------------------------------------------
+int computePriors(NeuralNetwork& net, const Position& pos, int plies, MovePriors& priors)
+{
+    priors.clear(pos.nbMoves() + plies);
+
+    // Toutes les positions jusqu'à plies - 1 coups, en largeur (transpositions comprises)
+    std::vector<Position> positions{pos};
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        const Position& p = positions[i];
+        if (p.nbMoves() + 1 >= pos.nbMoves() + plies)
+            continue;
+        for (int col = 0; col < Position::WIDTH; col++)
+        {
+            if (!p.canPlay(col) || p.isWinningMove(col))
+                continue;
+            Position child = p;
+            child.play(col);
+            positions.push_back(child);
+            if (positions.size() >= MovePriors::CAPACITY / 2)
+                break;
+        }
+    }
+
+    std::vector<NetworkOutput> outputs;
+    evaluateBatches(net, positions.data(), positions.size(), outputs, []() { return false; });
+
+    int stored = 0;
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        uint8_t policy[MAX_WIDTH] = {};
+        for (int col = 0; col < Position::WIDTH; col++)
+            policy[col] = static_cast<uint8_t>(std::lround(std::max(0.0f, std::min(1.0f, outputs[i].policy[col])) * 255));
+        if (priors.store(positions[i].key(), policy))
+            stored++;
+    }
+    return stored;
+}
+
+// ---------------------------------------------------------
+// Recherche avec le réseau aux feuilles
+// ---------------------------------------------------------
+SearchResult searchNeural(NeuralNetwork& net, const Position& pos, const SearchLimits& limits, SearchStats* stats)
+{
+    const auto start = Clock::now();
+    const auto deadline = start + limits.time;
+    const bool unlimited = limits.time.count() == 0 && limits.nodes == 0 && limits.maxDepth >= MAX_CELLS;
+    const int maxDepth = std::min(unlimited ? NEURAL_DEFAULT_DEPTH : limits.maxDepth,
+                                  Position::CELLS - pos.nbMoves());
+
+    if (stats)
+    {
+        *stats = SearchStats();
+        stats->source = SearchSource::Search;
+    }
+
+    SearchResult result;
+    FullWidthTree tree;
+    std::vector<NetworkOutput> values;
+    Position root = pos;
+
+    for (int depth = std::max(1, limits.minDepth); depth <= maxDepth; depth++)
+    {
+        tree.collect(root, depth);
+        const std::vector<Position>& leaves = tree.leaves();
+        if (limits.nodes > 0 && result.depth > 0 && result.nodes + leaves.size() > limits.nodes)
+            break;
+
+        const bool complete = evaluateBatches(net, leaves.data(), leaves.size(), values, [&]() {
+            return (limits.stop && limits.stop->load(std::memory_order_relaxed)) ||
+                   (limits.time.count() > 0 && result.depth > 0 && Clock::now() >= deadline);
+        });
+        if (!complete)
+            break;
+
+        int scores[Position::WIDTH];
+        const int move = tree.backup(root, depth, values, scores);
+        result.move = move;
+        result.score = move >= 0 ? scores[move] : 0;
+        result.depth = depth;
+        result.nodes += leaves.size();
+
+        if (stats)
+        {
+            SearchStats::Iteration& it = stats->iterations[stats->iterationCount++];
+            it.depth = depth;
+            it.move = move;
+            it.score = result.score;
+            it.nodes = result.nodes;
+            it.time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+        }
+
+        // Fin de partie prouvée ou plus rien à développer
+        if (std::abs(result.score) >= WIN_SCORE || leaves.empty())
+            break;
+    }
+
+    if (stats)
+    {
+        stats->nodes = result.nodes;
+        stats->depth = result.depth;
+        stats->time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+        if (result.move >= 0)
+        {
+            stats->pv[0] = static_cast<int8_t>(result.move);
+            stats->pvLength = 1;
+        }
+    }
+    return result;
+}
+}
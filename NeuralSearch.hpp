@@ -0,0 +1,32 @@
+#pragma once
+
+#include "MovePriors.hpp"
+#include "NegamaxEngine.hpp"
+#include "NeuralNetwork.hpp"
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// Score d'une feuille évaluée par le réseau : valeur ramenée à [-NEURAL_SCORE, +NEURAL_SCORE]
+// (toujours sous WIN_SCORE : seules les fins de partie trouvées par la recherche sont prouvées)
+constexpr int NEURAL_SCORE = 1000;
+
+// Profondeur de searchNeural() sans aucune limite (7^4 feuilles au plus)
+constexpr int NEURAL_DEFAULT_DEPTH = 4;
+
+// Politique du réseau pour toutes les positions à moins de plies coups de pos
+// (pos comprise), évaluées par lots de net.maxBatch() positions.
+// priors est vidé puis rempli ; à passer à la recherche par SearchOptions::priors.
+// Retourne le nombre de positions évaluées.
+int computePriors(NeuralNetwork& net, const Position& pos, int plies, MovePriors& priors);
+
+// Recherche à pleine largeur par approfondissement itératif, le réseau évaluant les feuilles :
+// à chaque profondeur, toutes les feuilles sont d'abord réunies puis évaluées par lots
+// de net.maxBatch() positions, et les scores remontés en negamax.
+// Seuls les coups sûrs sont développés (victoire immédiate, parade, jamais sous une menace).
+// Budget : limits.time / limits.stop (vérifiés entre deux lots), limits.nodes (feuilles),
+// limits.maxDepth (NEURAL_DEFAULT_DEPTH sans aucune limite).
+// stats (optionnel) : source Search, feuilles évaluées, profondeur, variante (premier coup).
+SearchResult searchNeural(NeuralNetwork& net, const Position& pos, const SearchLimits& limits,
+                          SearchStats* stats = nullptr);
+}
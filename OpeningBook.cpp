@@ -0,0 +1,216 @@
+#include "OpeningBook.hpp"
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "Solver.hpp"
+#include "TranspositionTable.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace SimpleAI
+{
+namespace
+{
+constexpr char MAGIC[4] = {'P', '4', 'O', 'B'};
+
+// ---------------------------------------------------------
+// Toutes les positions distinctes, non terminales, jusqu'à maxPly pions
+// (une seule de chaque paire de positions symétriques)
+// ---------------------------------------------------------
+std::vector<Position> enumeratePositions(int maxPly)
+{
+    std::vector<Position> all;
+    std::vector<Position> current(1);  // grille vide
+
+    for (int ply = 0; ply <= maxPly; ply++)
+    {
+        all.insert(all.end(), current.begin(), current.end());
+        if (ply == maxPly)
+            break;
+
+        std::vector<Position> next;
+        next.reserve(current.size() * Position::WIDTH);
+        for (const Position& pos : current)
+        {
+            for (int col = 0; col < Position::WIDTH; col++)
+            {
+                // Une position gagnée n'a pas de suite à mémoriser
+                if (!pos.canPlay(col) || pos.isWinningMove(col))
+                    continue;
+                Position child = pos;
+                child.play(col);
+                next.push_back(child);
+            }
+        }
+
+        // Transpositions (une même position atteinte par plusieurs ordres de coups) et symétriques
+        auto byKey = [](const Position& a, const Position& b) { return a.canonicalKey() < b.canonicalKey(); };
+        auto sameKey = [](const Position& a, const Position& b) { return a.canonicalKey() == b.canonicalKey(); };
+        std::sort(next.begin(), next.end(), byKey);
+        next.erase(std::unique(next.begin(), next.end(), sameKey), next.end());
+        current.swap(next);
+    }
+
+    return all;
+}
+}
+
+// ---------------------------------------------------------
+// Ouverture du fichier
+// ---------------------------------------------------------
+bool OpeningBook::open(const std::string& path)
+{
+    close();
+
+    if (!file_.open(path))
+        return false;
+
+    if (file_.size() < sizeof(Header))
+    {
+        close();
+        return false;
+    }
+
+    Header header;
+    std::memcpy(&header, file_.data(), sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0
+        || header.version != VERSION
+        || file_.size() < sizeof(Header) + header.count * sizeof(Record))
+    {
+        close();
+        return false;
+    }
+
+    records_ = reinterpret_cast<const Record*>(file_.data() + sizeof(Header));
+    count_ = static_cast<size_t>(header.count);
+    maxPly_ = static_cast<int>(header.maxPly);
+    return true;
+}
+
+void OpeningBook::close()
+{
+    file_.close();
+    records_ = nullptr;
+    count_ = 0;
+    maxPly_ = 0;
+}
+
+// ---------------------------------------------------------
+// Recherche dichotomique
+// ---------------------------------------------------------
+bool OpeningBook::probe(const Position& pos, int& move, int& score, bool* solved) const
+{
+    if (!records_)
+        return false;
+
+    bool mirrored = false;
+    const uint64_t key = pos.canonicalKey(mirrored);
+    const Record* end = records_ + count_;
+    const Record* it = std::lower_bound(records_, end, key,
+                                        [](const Record& r, uint64_t k) { return r.key < k; });
+    if (it == end || it->key != key)
+        return false;
+
+    move = (mirrored && it->move >= 0) ? Position::mirrorColumn(it->move) : it->move;
+    score = it->score;
+    if (solved)
+        *solved = it->solved != 0;
+    return true;
+}
+
+// ---------------------------------------------------------
+// Génération hors ligne
+// ---------------------------------------------------------
+bool OpeningBook::generate(const std::string& path, int maxPly, int depth, bool solve, int threads,
+                           const std::function<void(size_t, size_t)>& progress)
+{
+    const std::vector<Position> positions = enumeratePositions(maxPly);
+    std::vector<Record> records(positions.size());
+
+    if (threads <= 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Recherche heuristique : table partagée entre les threads, les sous-arbres communs
+    // aux ouvertures ne sont cherchés qu'une fois (inutile au solveur, qui a la sienne)
+    std::unique_ptr<TranspositionTable> tt;
+    if (!solve)
+        tt = std::make_unique<TranspositionTable>(TranspositionTable::MAX_SIZE / 8);
+    std::atomic<size_t> nextIndex{0};
+    std::atomic<size_t> done{0};
+
+    auto worker = [&]() {
+        SearchLimits limits;
+        limits.maxDepth = depth;
+
+        // Solveur propre à chaque thread (sa table n'est pas partageable), sinon moteur sur la table commune
+        std::unique_ptr<Solver> solver;
+        std::unique_ptr<NegamaxEngine> engine;
+        if (solve)
+            solver = std::make_unique<Solver>();
+        else
+            engine = std::make_unique<NegamaxEngine>(tt.get());
+
+        for (size_t n = nextIndex++; n < positions.size(); n = nextIndex++)
+        {
+            // Solveur : positions les plus avancées d'abord, leurs résultats restent dans la table
+            // de chaque thread et abrègent la résolution des ouvertures plus courtes
+            const size_t i = solver ? positions.size() - 1 - n : n;
+            const Position& pos = positions[i];
+            SearchResult result;
+            if (solver)
+            {
+                int scores[Position::WIDTH];
+                solver->analyze(pos, scores, result.move);
+                result.score = result.move >= 0 ? Solver::toSearchScore(scores[result.move]) : 0;
+                result.depth = Position::CELLS - pos.nbMoves();
+            }
+            else
+                result = engine->search(pos, limits);
+
+            // Coup mémorisé du côté de la clé canonique
+            bool mirrored = false;
+            Record& r = records[i];
+            std::memset(&r, 0, sizeof(Record));
+            r.key = pos.canonicalKey(mirrored);
+            r.score = static_cast<int16_t>(result.score);
+            r.move = static_cast<int8_t>((mirrored && result.move >= 0) ? Position::mirrorColumn(result.move)
+                                                                        : result.move);
+            r.depth = static_cast<uint8_t>(result.depth);
+            r.solved = solve ? 1 : 0;
+
+            const size_t finished = ++done;
+            if (progress)
+                progress(finished, positions.size());
+        }
+    };
+
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; t++)
+        pool.emplace_back(worker);
+    for (std::thread& t : pool)
+        t.join();
+
+    std::sort(records.begin(), records.end(),
+              [](const Record& a, const Record& b) { return a.key < b.key; });
+
+    Header header;
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.maxPly = static_cast<uint32_t>(maxPly);
+    header.depth = static_cast<uint32_t>(solve ? Position::CELLS : depth);
+    header.count = records.size();
+
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    if (!out)
+        return false;
+    out.write(reinterpret_cast<const char*>(&header), sizeof(Header));
+    out.write(reinterpret_cast<const char*>(records.data()),
+              static_cast<std::streamsize>(records.size() * sizeof(Record)));
+    return static_cast<bool>(out);
+}
+}
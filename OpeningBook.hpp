@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include "MappedFile.hpp"
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   BIBLIOTHÈQUE D'OUVERTURES
+// =============================================================
+// Fichier binaire généré hors ligne (outil book_generator) :
+//   - un en-tête (Header)
+//   - les positions jusqu'à maxPly pions, triées par clé (Record) ; une position
+//     et sa symétrique par rapport à la colonne centrale partagent un Record
+// Le fichier est projeté en mémoire au démarrage et interrogé par
+// recherche dichotomique : aucune lecture ni allocation à l'ouverture.
+// Format natif petit-boutiste (x86 / x64).
+class OpeningBook
+{
+public:
+    struct Header
+    {
+        char magic[4];        // "P4OB"
+        uint32_t version;
+        uint32_t maxPly;      // positions jusqu'à maxPly pions
+        uint32_t depth;       // profondeur de recherche utilisée pour la génération (CELLS si résolue)
+        uint64_t count;       // nombre de Record
+    };
+
+    struct Record
+    {
+        uint64_t key;         // Position::canonicalKey()
+        int16_t score;        // score du point de vue du joueur au trait
+        int8_t move;          // meilleure colonne (orientation de la clé canonique)
+        uint8_t depth;        // profondeur de la recherche (cases restantes si solved)
+        uint8_t solved;       // 1 : score exact du solveur (jeu parfait), 0 : recherche heuristique
+        uint8_t padding[3];
+    };
+
+    static constexpr uint32_t VERSION = 3;   // 2 : clés canoniques (symétrie), 3 : drapeau solved
+
+    // Projette un fichier de bibliothèque en mémoire (false si absent ou invalide)
+    bool open(const std::string& path);
+    void close();
+
+    bool isOpen() const { return records_ != nullptr; }
+    size_t size() const { return count_; }
+    int maxPly() const { return maxPly_; }
+
+    // Cherche une position (ou sa symétrique), retourne false si elle n'est pas dans la bibliothèque
+    // solved (optionnel) : le coup et le score viennent du solveur exact
+    bool probe(const Position& pos, int& move, int& score, bool* solved = nullptr) const;
+
+    // Génère la bibliothèque : toutes les positions jusqu'à maxPly pions sont résolues
+    // exactement (solve, coups parfaits) ou cherchées à la profondeur depth,
+    // réparties sur threads cœurs (0 = tous)
+    // progress (optionnel) est appelé depuis les threads de calcul
+    static bool generate(const std::string& path, int maxPly, int depth, bool solve, int threads = 0,
+                         const std::function<void(size_t done, size_t total)>& progress = {});
+
+private:
+    MappedFile file_;
+    const Record* records_ = nullptr;
+    size_t count_ = 0;
+    int maxPly_ = 0;
+};
+}
@@ -0,0 +1,185 @@
+#include "Ponderer.hpp"
+#include <algorithm>
+
+namespace SimpleAI
+{
+namespace
+{
+// Tranche de temps initiale du solveur par branche (doublée à chaque tour)
+constexpr std::chrono::milliseconds SOLVER_SLICE{25};
+}
+
+Ponderer::Ponderer(TranspositionTable* tt, Solver* solver, WorkerPool* pool)
+    : tt_(tt), solver_(solver), pool_(pool)
+{
+}
+
+Ponderer::~Ponderer()
+{
+    stop();
+}
+
+// ---------------------------------------------------------
+// Démarrage : une branche par coup adverse possible
+// ---------------------------------------------------------
+void Ponderer::start(const Position& pos, const SearchLimits& limits, bool useSolver)
+{
+    stop();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        replyCount_ = 0;
+        for (int col : Position::CENTER_ORDER)
+        {
+            // Un coup gagnant de l'adversaire termine la partie : rien à préparer
+            if (!pos.canPlay(col) || pos.isWinningMove(col))
+                continue;
+
+            Reply& reply = replies_[replyCount_++];
+            reply = Reply();
+            reply.pos = pos;
+            reply.pos.play(col);
+        }
+    }
+
+    stop_ = false;
+    const bool solve = useSolver && solver_;
+    if (pool_)
+        task_ = pool_->submit([this, limits, solve]() { run(limits, solve); });
+    else
+        thread_ = std::thread(&Ponderer::run, this, limits, solve);
+}
+
+void Ponderer::stop()
+{
+    stop_ = true;
+    if (thread_.joinable())
+        thread_.join();
+    if (task_.valid())
+        task_.get();
+}
+
+bool Ponderer::result(uint64_t key, SearchResult& out, bool& solved, std::chrono::milliseconds& spent) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (int i = 0; i < replyCount_; i++)
+    {
+        const Reply& reply = replies_[i];
+        if (reply.pos.key() != key)
+            continue;
+
+        out = reply.result;
+        solved = reply.solved;
+        spent = std::chrono::duration_cast<std::chrono::milliseconds>(reply.spent);
+        return reply.result.depth > 0 || reply.solved;
+    }
+    return false;
+}
+
+// ---------------------------------------------------------
+// Thread de réflexion
+// ---------------------------------------------------------
+void Ponderer::run(SearchLimits limits, bool useSolver)
+{
+    if (useSolver)
+        ponderSolver();
+
+    // Les branches que le solveur n'a pas résolues sont cherchées par Negamax
+    if (!stop_)
+        ponderNegamax(limits);
+}
+
+void Ponderer::ponderSolver()
+{
+    solver_->setStopFlag(&stop_);
+
+    // Tranches de temps croissantes, à tour de rôle : les branches faciles sont résolues d'abord
+    // (la table du solveur conserve le travail des tranches interrompues)
+    for (auto slice = SOLVER_SLICE; !stop_; slice *= 2)
+    {
+        bool allSolved = true;
+        for (int i = 0; i < replyCount_ && !stop_; i++)
+        {
+            if (replies_[i].solved)
+                continue;
+
+            const Position pos = replies_[i].pos;
+            const auto begin = std::chrono::steady_clock::now();
+
+            solver_->setTimeLimit(slice);
+            int scores[Position::WIDTH];
+            int move = -1;
+            const bool solved = solver_->analyze(pos, scores, move) && move >= 0;
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            Reply& reply = replies_[i];
+            reply.spent += std::chrono::steady_clock::now() - begin;
+            if (solved)
+            {
+                reply.solved = true;
+                reply.result.move = move;
+                reply.result.score = scores[move];
+                reply.result.depth = Position::CELLS - pos.nbMoves();
+            }
+            else
+            {
+                allSolved = false;
+            }
+        }
+
+        if (allSolved)
+            break;
+
+        // Au-delà de quelques secondes par branche le solveur n'aboutira pas pendant ce tour
+        if (slice > std::chrono::seconds(2))
+            break;
+    }
+
+    solver_->setStopFlag(nullptr);
+    solver_->setTimeLimit(std::chrono::milliseconds(0));
+}
+
+void Ponderer::ponderNegamax(const SearchLimits& limits)
+{
+    NegamaxEngine engine(tt_);
+    engine.setStopFlag(&stop_);
+
+    for (int depth = std::max(1, limits.minDepth); depth <= limits.maxDepth && !stop_; depth++)
+    {
+        bool pending = false;
+        for (int i = 0; i < replyCount_ && !stop_; i++)
+        {
+            if (replies_[i].solved)
+                continue;
+
+            const Position pos = replies_[i].pos;
+            const SearchResult previous = replies_[i].result;
+
+            // Branche déjà tranchée (victoire/défaite forcée) ou grille pleine
+            if (previous.score >= WIN_SCORE || previous.score <= -WIN_SCORE
+                || depth > Position::CELLS - pos.nbMoves())
+                continue;
+            pending = true;
+
+            SearchLimits iteration;
+            iteration.minDepth = depth;
+            iteration.maxDepth = depth;
+
+            const auto begin = std::chrono::steady_clock::now();
+            const SearchResult r = engine.search(pos, iteration);
+
+            std::lock_guard<std::mutex> lock(mutex_);
+            Reply& reply = replies_[i];
+            reply.spent += std::chrono::steady_clock::now() - begin;
+            if (r.depth == depth)
+            {
+                reply.result = r;
+                reply.result.nodes += previous.nodes;
+            }
+        }
+
+        if (!pending)
+            break;
+    }
+}
+}
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <mutex>
+#include <thread>
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "Solver.hpp"
+#include "TranspositionTable.hpp"
+#include "WorkerPool.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   PONDÉRATION (réflexion pendant le tour de l'adversaire)
+// =============================================================
+// Pendant que l'adversaire réfléchit, un thread d'arrière-plan cherche
+// la réponse à chacun de ses coups possibles, à tour de rôle et de plus
+// en plus profond. Les résultats remplissent la table de transposition
+// partagée (et celle du solveur) : une fois le coup adverse connu, la
+// recherche du robot repart de ce qui a déjà été calculé pour cette
+// branche, les autres sont abandonnées.
+class Ponderer
+{
+public:
+    // tt : table partagée avec la recherche du robot, solver (optionnel) pour le mode jeu parfait,
+    // pool (optionnel, non possédé) : la réflexion occupe un de ses threads au lieu d'un thread dédié
+    explicit Ponderer(TranspositionTable* tt, Solver* solver = nullptr, WorkerPool* pool = nullptr);
+    ~Ponderer();
+
+    Ponderer(const Ponderer&) = delete;
+    Ponderer& operator=(const Ponderer&) = delete;
+
+    // Démarre la réflexion sur pos (adversaire au trait), limits.maxDepth borne la profondeur
+    void start(const Position& pos, const SearchLimits& limits, bool useSolver);
+
+    // Arrête la réflexion et attend le thread (quelques millisecondes au plus)
+    void stop();
+
+    bool isRunning() const { return thread_.joinable() || task_.valid(); }
+
+    // Résultat préparé pour la position key (robot au trait après le coup adverse)
+    // solved : score exact du solveur, spent : temps de réflexion consacré à cette branche
+    bool result(uint64_t key, SearchResult& out, bool& solved, std::chrono::milliseconds& spent) const;
+
+private:
+    struct Reply
+    {
+        Position pos;                          // position après le coup adverse
+        SearchResult result;                   // dernière itération terminée
+        bool solved = false;                   // résultat exact du solveur
+        std::chrono::steady_clock::duration spent{0};
+    };
+
+    void run(SearchLimits limits, bool useSolver);
+    void ponderSolver();
+    void ponderNegamax(const SearchLimits& limits);
+
+    TranspositionTable* tt_;
+    Solver* solver_;
+    WorkerPool* pool_;
+
+    std::thread thread_;
+    std::future<void> task_;                   // réflexion en cours sur pool_
+    std::atomic<bool> stop_{false};
+
+    mutable std::mutex mutex_;                 // protège replies_ / replyCount_
+    Reply replies_[Position::WIDTH];
+    int replyCount_ = 0;
+};
+}
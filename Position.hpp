@@ -0,0 +1,363 @@
+#pragma once
+
+#include <cstdint>
+#include <initializer_list>
+#include <type_traits>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace SimpleAI
+{
+// ---------------------------------------------------------
+// Nombre de bits à 1 dans un bitboard
+// ---------------------------------------------------------
+inline int popcount(uint64_t b)
+{
+#ifdef _MSC_VER
+    return static_cast<int>(__popcnt64(b));
+#else
+    return __builtin_popcountll(b);
+#endif
+}
+
+// =============================================================
+//   BITBOARD 128 BITS (grilles de plus de 64 bits, ex. 9 x 7)
+// =============================================================
+// Deux mots de 64 bits et les seules opérations utilisées par les
+// recherches ; tout est constexpr pour générer les masques à la compilation.
+struct Bitboard128
+{
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+
+    constexpr Bitboard128() = default;
+    constexpr Bitboard128(uint64_t low) : lo(low), hi(0) {}
+    constexpr Bitboard128(uint64_t low, uint64_t high) : lo(low), hi(high) {}
+
+    constexpr explicit operator bool() const { return (lo | hi) != 0; }
+
+    friend constexpr Bitboard128 operator|(Bitboard128 a, Bitboard128 b) { return {a.lo | b.lo, a.hi | b.hi}; }
+    friend constexpr Bitboard128 operator&(Bitboard128 a, Bitboard128 b) { return {a.lo & b.lo, a.hi & b.hi}; }
+    friend constexpr Bitboard128 operator^(Bitboard128 a, Bitboard128 b) { return {a.lo ^ b.lo, a.hi ^ b.hi}; }
+    friend constexpr Bitboard128 operator~(Bitboard128 a) { return {~a.lo, ~a.hi}; }
+    friend constexpr bool operator==(Bitboard128 a, Bitboard128 b) { return a.lo == b.lo && a.hi == b.hi; }
+    friend constexpr bool operator!=(Bitboard128 a, Bitboard128 b) { return !(a == b); }
+
+    friend constexpr Bitboard128 operator+(Bitboard128 a, Bitboard128 b)
+    {
+        const uint64_t lo = a.lo + b.lo;
+        return {lo, a.hi + b.hi + (lo < a.lo ? 1 : 0)};
+    }
+
+    friend constexpr Bitboard128 operator-(Bitboard128 a, Bitboard128 b)
+    {
+        return {a.lo - b.lo, a.hi - b.hi - (a.lo < b.lo ? 1 : 0)};
+    }
+
+    friend constexpr Bitboard128 operator<<(Bitboard128 a, int n)
+    {
+        if (n == 0) return a;
+        if (n >= 128) return {};
+        if (n >= 64) return {0, a.lo << (n - 64)};
+        return {a.lo << n, (a.hi << n) | (a.lo >> (64 - n))};
+    }
+
+    friend constexpr Bitboard128 operator>>(Bitboard128 a, int n)
+    {
+        if (n == 0) return a;
+        if (n >= 128) return {};
+        if (n >= 64) return {a.hi >> (n - 64), 0};
+        return {(a.lo >> n) | (a.hi << (64 - n)), a.hi >> n};
+    }
+
+    constexpr Bitboard128& operator|=(Bitboard128 b) { return *this = *this | b; }
+    constexpr Bitboard128& operator&=(Bitboard128 b) { return *this = *this & b; }
+    constexpr Bitboard128& operator^=(Bitboard128 b) { return *this = *this ^ b; }
+};
+
+inline int popcount(Bitboard128 b)
+{
+    return popcount(b.lo) + popcount(b.hi);
+}
+
+// Clé de 64 bits d'un bitboard (identité sur 64 bits, mélange des deux mots sur 128)
+inline uint64_t foldKey(uint64_t b) { return b; }
+inline uint64_t foldKey(Bitboard128 b) { return b.lo ^ (b.hi * 0x9E3779B97F4A7C15ull); }
+
+// Plus grande grille gérée (9 colonnes x 7 lignes) : taille des tableaux indépendants de la grille
+constexpr int MAX_WIDTH = 9;
+constexpr int MAX_CELLS = 9 * 7;
+
+// Colonnes dans un ordre donné (parcourable par for (int col : ORDER))
+template <int Width>
+struct ColumnOrder
+{
+    int cols[Width];
+    constexpr const int* begin() const { return cols; }
+    constexpr const int* end() const { return cols + Width; }
+    constexpr int operator[](int i) const { return cols[i]; }
+};
+
+// =============================================================
+//   POSITION EN BITBOARD (Cols colonnes x Rows lignes)
+// =============================================================
+// Chaque colonne occupe HEIGHT + 1 bits : les cases de bas en haut
+// puis un bit sentinelle toujours vide qui empêche les alignements
+// de "déborder" d'une colonne sur la suivante. Grille standard 7 x 6 :
+//
+//   .  .  .  .  .  .  .    <- sentinelles
+//   5 12 19 26 33 40 47
+//   4 11 18 25 32 39 46
+//   3 10 17 24 31 38 45
+//   2  9 16 23 30 37 44
+//   1  8 15 22 29 36 43
+//   0  7 14 21 28 35 42
+//
+// current_ : pions du joueur au trait
+// mask_    : toutes les cases occupées
+//
+// Les dimensions sont des paramètres de template : masques calculés à la
+// compilation, aucune dimension testée pendant la recherche. Jusqu'à 64 bits
+// (7 x 6, 8 x 7) le bitboard est un uint64_t, au-delà (9 x 7) un Bitboard128.
+//
+// Les recherches jouent et annulent les coups sur une seule position
+// (play / undo) : aucune copie ni allocation par nœud.
+template <int Rows, int Cols>
+class BasicPosition
+{
+public:
+    static constexpr int WIDTH = Cols;
+    static constexpr int HEIGHT = Rows;
+    static constexpr int CELLS = WIDTH * HEIGHT;
+    static constexpr int BITS = WIDTH * (HEIGHT + 1);
+
+    static_assert(WIDTH >= 4 && HEIGHT >= 4, "Grille trop petite pour aligner 4 pions");
+    static_assert(WIDTH <= MAX_WIDTH && CELLS <= MAX_CELLS, "Grille plus grande que MAX_WIDTH / MAX_CELLS");
+
+    using Bitboard = std::conditional_t<(BITS <= 64), uint64_t, Bitboard128>;
+
+    BasicPosition() = default;
+
+    // Construit une position à partir des pions du joueur au trait et des cases occupées
+    BasicPosition(Bitboard current, Bitboard mask)
+        : current_(current), mask_(mask)
+    {
+        moves_ = popcount(mask);
+        for (int col = 0; col < WIDTH; col++)
+        {
+            // Hauteur = case libre au-dessus du pion le plus haut
+            int h = HEIGHT;
+            while (h > 0 && !(mask & cellMask(h - 1, col)))
+                h--;
+            height_[col] = static_cast<uint8_t>(h);
+        }
+    }
+
+    // Vérifie si la colonne est jouable
+    bool canPlay(int col) const
+    {
+        return height_[col] < HEIGHT;
+    }
+
+    // Joue un pion du joueur au trait (la colonne doit être jouable)
+    void play(int col)
+    {
+        current_ ^= mask_;  // current_ devient les pions de l'adversaire
+        mask_ |= cellMask(height_[col], col);
+        height_[col]++;
+        moves_++;
+    }
+
+    // Annule le dernier coup, joué dans la colonne col
+    void undo(int col)
+    {
+        height_[col]--;
+        mask_ ^= cellMask(height_[col], col);
+        current_ ^= mask_;  // current_ redevient les pions du joueur qui avait joué
+        moves_--;
+    }
+
+    // Vérifie si jouer dans la colonne fait gagner le joueur au trait
+    bool isWinningMove(int col) const
+    {
+        return hasAlignment(current_ | cellMask(height_[col], col));
+    }
+
+    // Vérifie si le joueur qui vient de jouer a aligné 4 pions
+    bool lastPlayerWon() const
+    {
+        return hasAlignment(current_ ^ mask_);
+    }
+
+    int nbMoves() const { return moves_; }
+    int height(int col) const { return height_[col]; }
+    Bitboard current() const { return current_; }
+    Bitboard opponent() const { return current_ ^ mask_; }
+    Bitboard mask() const { return mask_; }
+
+    // Clé unique de la position (current + mask), repliée sur 64 bits pour les grilles de 128 bits
+    uint64_t key() const { return foldKey(current_ + mask_); }
+
+    // Clé commune à la position et à sa symétrique par rapport à la colonne centrale
+    // (la plus petite des deux). mirrored : la clé retenue est celle de la symétrique,
+    // les colonnes mémorisées sous cette clé sont alors à retourner avec mirrorColumn().
+    uint64_t canonicalKey(bool& mirrored) const
+    {
+        const Bitboard k = current_ + mask_;
+        const uint64_t direct = foldKey(k);
+        const uint64_t reflected = foldKey(mirror(k));
+        mirrored = reflected < direct;
+        return mirrored ? reflected : direct;
+    }
+
+    uint64_t canonicalKey() const
+    {
+        bool mirrored;
+        return canonicalKey(mirrored);
+    }
+
+    // Colonne symétrique par rapport à la colonne centrale
+    static constexpr int mirrorColumn(int col) { return WIDTH - 1 - col; }
+
+    // Symétrique d'un bitboard : les colonnes (sentinelle comprise) dans l'ordre inverse
+    static constexpr Bitboard mirror(Bitboard b)
+    {
+        constexpr Bitboard column = (Bitboard(1) << (HEIGHT + 1)) - Bitboard(1);
+        Bitboard r = 0;
+        for (int col = 0; col < WIDTH; col++)
+            r |= ((b >> (col * (HEIGHT + 1))) & column) << ((WIDTH - 1 - col) * (HEIGHT + 1));
+        return r;
+    }
+
+    // Case (row compté depuis le bas, col)
+    static constexpr Bitboard cellMask(int row, int col)
+    {
+        return Bitboard(1) << (col * (HEIGHT + 1) + row);
+    }
+
+    static constexpr Bitboard bottomMask(int col)
+    {
+        return Bitboard(1) << (col * (HEIGHT + 1));
+    }
+
+    static constexpr Bitboard columnMask(int col)
+    {
+        return ((Bitboard(1) << HEIGHT) - Bitboard(1)) << (col * (HEIGHT + 1));
+    }
+
+    // Nombre de cases vides qui donneraient un alignement au joueur au trait après avoir joué col
+    int threatsAfter(int col) const
+    {
+        const Bitboard move = cellMask(height_[col], col);
+        return popcount(winningCells(current_ | move) & ~(mask_ | move) & BOARD_MASK);
+    }
+
+    // Cases jouables : une par colonne non pleine, juste au-dessus du dernier pion
+    // (décalage plutôt qu'addition : aucune retenue à propager sur 128 bits)
+    Bitboard possible() const
+    {
+        return ((mask_ << 1) | BOTTOM_MASK) & ~mask_ & BOARD_MASK;
+    }
+
+    // Le joueur au trait a-t-il un coup gagnant ?
+    bool canWinNext() const
+    {
+        return static_cast<bool>(winningCells(current_) & possible());
+    }
+
+    // Cases jouables qui ne laissent pas l'adversaire gagner au coup suivant
+    // (0 si tous les coups perdent : deux menaces adverses jouables à la fois)
+    Bitboard possibleNonLosingMoves() const
+    {
+        Bitboard moves = possible();
+        const Bitboard opponentWin = winningCells(current_ ^ mask_) & ~mask_;
+        const Bitboard forced = moves & opponentWin;
+        if (forced)
+        {
+            if (forced & (forced - Bitboard(1)))
+                return Bitboard(0);  // deux menaces à parer
+            moves = forced;          // parade obligatoire
+        }
+        return moves & ~(opponentWin >> 1);  // ne pas jouer sous une menace adverse
+    }
+
+    // Cases (vides ou non) qui compléteraient un alignement de 4 pour les pions pos
+    static Bitboard winningCells(Bitboard pos)
+    {
+        // Vertical : 3 pions l'un sur l'autre, la case au-dessus
+        Bitboard r = (pos << 1) & (pos << 2) & (pos << 3);
+
+        // Horizontal et diagonales : décalage d'une colonne (s = HEIGHT + 1), d'une diagonale (s = HEIGHT / HEIGHT + 2)
+        for (int s : {HEIGHT + 1, HEIGHT, HEIGHT + 2})
+        {
+            Bitboard p = (pos << s) & (pos << 2 * s);
+            r |= p & (pos << 3 * s);   // xxx.
+            r |= p & (pos >> s);       // xx.x
+            p = (pos >> s) & (pos >> 2 * s);
+            r |= p & (pos << s);       // x.xx
+            r |= p & (pos >> 3 * s);   // .xxx
+        }
+
+        return r & BOARD_MASK;
+    }
+
+    // Toutes les cases de la grille (sans les sentinelles)
+    static constexpr Bitboard BOARD_MASK = [] {
+        Bitboard b = 0;
+        for (int col = 0; col < WIDTH; col++)
+            b |= ((Bitboard(1) << HEIGHT) - Bitboard(1)) << (col * (HEIGHT + 1));
+        return b;
+    }();
+
+    // Case du bas de chaque colonne
+    static constexpr Bitboard BOTTOM_MASK = [] {
+        Bitboard b = 0;
+        for (int col = 0; col < WIDTH; col++)
+            b |= Bitboard(1) << (col * (HEIGHT + 1));
+        return b;
+    }();
+
+    // Colonnes du centre vers les bords, gauche d'abord (7 colonnes : 3 2 4 1 5 0 6)
+    static constexpr ColumnOrder<WIDTH> CENTER_ORDER = [] {
+        ColumnOrder<WIDTH> order = {};
+        for (int i = 0; i < WIDTH; i++)
+            order.cols[i] = WIDTH / 2 + ((i % 2) ? -(i + 1) / 2 : i / 2);
+        return order;
+    }();
+
+    // Détection de 4 alignés par décalages (horizontal, vertical, 2 diagonales)
+    static bool hasAlignment(Bitboard pos)
+    {
+        // Horizontal
+        Bitboard m = pos & (pos >> (HEIGHT + 1));
+        if (m & (m >> (2 * (HEIGHT + 1)))) return true;
+
+        // Diagonale /
+        m = pos & (pos >> (HEIGHT + 2));
+        if (m & (m >> (2 * (HEIGHT + 2)))) return true;
+
+        // Diagonale
+        m = pos & (pos >> HEIGHT);
+        if (m & (m >> (2 * HEIGHT))) return true;
+
+        // Vertical
+        m = pos & (pos >> 1);
+        if (m & (m >> 2)) return true;
+
+        return false;
+    }
+
+private:
+    Bitboard current_ = 0;
+    Bitboard mask_ = 0;
+    uint8_t height_[WIDTH] = {};
+    int moves_ = 0;
+};
+
+// Grille standard (7 colonnes x 6 lignes) et variantes 8 x 7, 9 x 7
+using Position = BasicPosition<6, 7>;
+using Position8x7 = BasicPosition<7, 8>;
+using Position9x7 = BasicPosition<7, 9>;
+}
@@ -0,0 +1,335 @@
+#include "PositionCache.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace SimpleAI
+{
+namespace
+{
+constexpr char MAGIC[4] = {'P', '4', 'P', 'C'};
+
+using Record = PositionCache::Record;
+
+// Record écrits par paquets lors de la fusion
+constexpr size_t WRITE_BATCH = 4096;
+
+// ---------------------------------------------------------
+// Fusion de la partie triée et des ajouts dans un nouveau fichier
+// (pour une même clé, l'ajout le plus récent l'emporte)
+// ---------------------------------------------------------
+bool writeCompacted(const std::string& path, PositionCache::Header header,
+                    const Record* sorted, size_t sortedCount, const Record* added, size_t addedCount)
+{
+    // Ajouts triés par clé, seul le dernier de chaque clé est conservé
+    std::vector<Record> tail(added, added + addedCount);
+    std::stable_sort(tail.begin(), tail.end(),
+                     [](const Record& a, const Record& b) { return a.key < b.key; });
+    size_t unique = 0;
+    for (size_t i = 0; i < tail.size(); i++)
+    {
+        if (unique > 0 && tail[unique - 1].key == tail[i].key)
+            tail[unique - 1] = tail[i];
+        else
+            tail[unique++] = tail[i];
+    }
+    tail.resize(unique);
+
+    std::FILE* file = std::fopen(path.c_str(), "wb");
+    if (!file)
+        return false;
+
+    // En-tête réécrit à la fin avec le nombre de Record
+    header.sorted = 0;
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    std::vector<Record> batch;
+    batch.reserve(WRITE_BATCH);
+    size_t i = 0;
+    size_t j = 0;
+    while (i < sortedCount || j < tail.size())
+    {
+        if (j == tail.size() || (i < sortedCount && sorted[i].key < tail[j].key))
+        {
+            batch.push_back(sorted[i++]);
+        }
+        else
+        {
+            if (i < sortedCount && sorted[i].key == tail[j].key)
+                i++;
+            batch.push_back(tail[j++]);
+        }
+        header.sorted++;
+
+        if (batch.size() == WRITE_BATCH)
+        {
+            std::fwrite(batch.data(), sizeof(Record), batch.size(), file);
+            batch.clear();
+        }
+    }
+    std::fwrite(batch.data(), sizeof(Record), batch.size(), file);
+
+    std::fseek(file, 0, SEEK_SET);
+    std::fwrite(&header, sizeof(header), 1, file);
+
+    const bool ok = !std::ferror(file);
+    if (std::fclose(file) != 0 || !ok)
+    {
+        std::remove(path.c_str());
+        return false;
+    }
+    return true;
+}
+}
+
+PositionCache::~PositionCache()
+{
+    close();
+}
+
+// ---------------------------------------------------------
+// Chargement : compactage puis projection du fichier
+// ---------------------------------------------------------
+bool PositionCache::open(const std::string& path, uint32_t engineVersion)
+{
+    close();
+
+    size_t valid = 0;  // octets lisibles (en-tête + Record complets)
+    if (mapped_.open(path) && mapped_.size() >= sizeof(Header))
+    {
+        Header header;
+        std::memcpy(&header, mapped_.data(), sizeof(Header));
+        if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0)
+        {
+            mapped_.close();
+            return false;  // autre fichier : ne pas l'écraser
+        }
+
+        // Autre format ou autre évaluation (scores incomparables) : le cache repart de zéro
+        if (header.version == VERSION && header.engine == engineVersion)
+        {
+            size_t count = (mapped_.size() - sizeof(Header)) / sizeof(Record);
+            const Record* records = reinterpret_cast<const Record*>(mapped_.data() + sizeof(Header));
+
+            // Ajouts des sessions précédentes fusionnés dans la partie triée
+            if (header.sorted < count)
+            {
+                const std::string compacted = path + ".tmp";
+                const size_t sorted = header.sorted;
+                if (!writeCompacted(compacted, header, records, sorted, records + sorted, count - sorted))
+                {
+                    mapped_.close();
+                    return false;
+                }
+                mapped_.close();
+                std::remove(path.c_str());
+                if (std::rename(compacted.c_str(), path.c_str()) != 0 || !mapped_.open(path))
+                    return false;
+
+                std::memcpy(&header, mapped_.data(), sizeof(Header));
+                count = (mapped_.size() - sizeof(Header)) / sizeof(Record);
+                records = reinterpret_cast<const Record*>(mapped_.data() + sizeof(Header));
+            }
+
+            sorted_ = records;
+            sortedCount_ = std::min<size_t>(header.sorted, count);
+            valid = sizeof(Header) + sortedCount_ * sizeof(Record);
+        }
+    }
+    if (valid == 0)
+        mapped_.close();
+
+    // Ajouts en fin de fichier ; un Record tronqué (arrêt brutal pendant l'écriture) est écrasé
+    std::FILE* file = std::fopen(path.c_str(), valid > 0 ? "r+b" : "wb");
+    if (!file)
+    {
+        close();
+        return false;
+    }
+
+    if (valid == 0)
+    {
+        Header header = {};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.engine = engineVersion;
+        header.sorted = 0;
+        std::fwrite(&header, sizeof(Header), 1, file);
+        valid = sizeof(Header);
+    }
+    std::fseek(file, static_cast<long>(valid), SEEK_SET);
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        file_ = file;
+        stopWriter_ = false;
+    }
+    writer_ = std::thread(&PositionCache::flushLoop, this);
+    return true;
+}
+
+void PositionCache::close()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopWriter_ = true;
+    }
+    wake_.notify_all();
+    if (writer_.joinable())
+        writer_.join();
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (file_)
+    {
+        std::fclose(file_);
+        file_ = nullptr;
+    }
+    added_.clear();
+    newKeys_ = 0;
+    pending_.clear();
+
+    sorted_ = nullptr;
+    sortedCount_ = 0;
+    mapped_.close();
+}
+
+bool PositionCache::isOpen() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return file_ != nullptr;
+}
+
+size_t PositionCache::size() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return sortedCount_ + newKeys_;
+}
+
+// ---------------------------------------------------------
+// Accès
+// ---------------------------------------------------------
+const PositionCache::Record* PositionCache::findSorted(uint64_t key) const
+{
+    const Record* end = sorted_ + sortedCount_;
+    const Record* it = std::lower_bound(sorted_, end, key,
+                                        [](const Record& r, uint64_t k) { return r.key < k; });
+    return (it != end && it->key == key) ? it : nullptr;
+}
+
+bool PositionCache::probe(const Position& pos, Record& out)
+{
+    const int ply = pos.nbMoves();
+    probes_[ply].fetch_add(1, std::memory_order_relaxed);
+
+    bool mirrored = false;
+    const uint64_t key = pos.canonicalKey(mirrored);
+
+    // Résultats de la session d'abord, puis la partie triée (lue hors verrou)
+    bool found = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = added_.find(key);
+        if (it != added_.end())
+        {
+            out = it->second;
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        const Record* record = findSorted(key);
+        if (!record)
+            return false;
+        out = *record;
+    }
+
+    hits_[ply].fetch_add(1, std::memory_order_relaxed);
+    if (mirrored)
+        out.move = static_cast<int8_t>(Position::mirrorColumn(out.move));
+    return true;
+}
+
+void PositionCache::store(const Position& pos, int score, int move, int depth, bool solved)
+{
+    if (move < 0 || depth <= 0)
+        return;
+
+    // Coup mémorisé du côté de la clé canonique
+    bool mirrored = false;
+    Record record = {};
+    record.key = pos.canonicalKey(mirrored);
+    record.score = static_cast<int16_t>(score);
+    record.move = static_cast<int8_t>(mirrored ? Position::mirrorColumn(move) : move);
+    record.depth = static_cast<uint8_t>(depth);
+    record.solved = solved ? 1 : 0;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!file_)
+        return;
+
+    // Un résultat exact ne se remplace pas, un résultat plus profond remplace le précédent
+    auto it = added_.find(record.key);
+    const Record* known = it != added_.end() ? &it->second : findSorted(record.key);
+    if (known && (known->solved || (!solved && known->depth >= record.depth)))
+        return;
+    if (!known)
+        newKeys_++;
+
+    added_[record.key] = record;
+    pending_.push_back(record);
+}
+
+// ---------------------------------------------------------
+// Écriture asynchrone
+// ---------------------------------------------------------
+void PositionCache::flush()
+{
+    wake_.notify_all();
+}
+
+void PositionCache::flushLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stopWriter_)
+    {
+        wake_.wait_for(lock, std::chrono::milliseconds(FLUSH_INTERVAL_MS));
+        writePending(lock);
+    }
+    writePending(lock);
+}
+
+void PositionCache::writePending(std::unique_lock<std::mutex>& lock)
+{
+    if (pending_.empty() || !file_)
+        return;
+
+    // Le disque est écrit hors verrou : probe() / store() ne sont jamais bloqués par une écriture
+    std::vector<Record> batch;
+    batch.swap(pending_);
+    std::FILE* file = file_;
+
+    lock.unlock();
+    std::fwrite(batch.data(), sizeof(Record), batch.size(), file);
+    std::fflush(file);
+    lock.lock();
+}
+
+// ---------------------------------------------------------
+// Statistiques
+// ---------------------------------------------------------
+double PositionCache::hitRate(int ply) const
+{
+    const uint64_t p = probes(ply);
+    return p ? static_cast<double>(hits(ply)) / static_cast<double>(p) : 0.0;
+}
+
+void PositionCache::resetStats()
+{
+    for (int ply = 0; ply <= Position::CELLS; ply++)
+    {
+        probes_[ply].store(0, std::memory_order_relaxed);
+        hits_[ply].store(0, std::memory_order_relaxed);
+    }
+}
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+#include "MappedFile.hpp"
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   CACHE PERSISTANT DES POSITIONS CHERCHÉES
+// =============================================================
+// Fichier binaire conservé entre les parties et les redémarrages :
+//   - un en-tête (Header) puis des Record de 16 octets à la suite
+//   - Header::sorted premiers Record triés par clé, sans doublon, puis les ajouts de la session
+//   - un Record ajouté plus récent remplace les précédents de même clé
+//   - une position et sa symétrique par rapport à la colonne centrale partagent une clé
+// Au démarrage les ajouts sont fusionnés dans la partie triée (doublons éliminés),
+// puis le fichier est projeté en mémoire et consulté sur place par recherche
+// dichotomique ; seuls les résultats de la session sont gardés en mémoire, et écrits
+// en fin de fichier par un thread d'arrière-plan : la recherche n'attend jamais le disque.
+// Un fichier d'une autre version (format ou moteur) est effacé.
+// Format natif petit-boutiste (x86 / x64).
+class PositionCache
+{
+public:
+    struct Header
+    {
+        char magic[4];        // "P4PC"
+        uint32_t version;     // format du fichier (VERSION)
+        uint32_t engine;      // version de l'évaluation qui a produit les scores (ENGINE_VERSION)
+        uint32_t sorted;      // Record triés en tête du fichier
+    };
+
+    struct Record
+    {
+        uint64_t key;         // Position::canonicalKey()
+        int16_t score;        // score du point de vue du joueur au trait (échelle NegamaxEngine)
+        int8_t move;          // meilleure colonne (orientation de la clé canonique)
+        uint8_t depth;        // profondeur de la recherche
+        uint8_t solved;       // 1 : score exact (solveur ou fin de partie atteinte)
+        uint8_t padding[3];
+    };
+
+    static constexpr uint32_t VERSION = 3;   // 2 : clés canoniques (symétrie), 3 : partie triée, version du moteur
+
+    // Délai maximum avant l'écriture des nouveaux résultats
+    static constexpr int FLUSH_INTERVAL_MS = 2000;
+
+    PositionCache() = default;
+    ~PositionCache();
+
+    PositionCache(const PositionCache&) = delete;
+    PositionCache& operator=(const PositionCache&) = delete;
+
+    // Compacte puis projette le fichier (créé, ou effacé si engineVersion ou le format
+    // diffèrent) et démarre le thread d'écriture
+    bool open(const std::string& path, uint32_t engineVersion);
+
+    // Écrit les résultats en attente et ferme le fichier
+    void close();
+
+    bool isOpen() const;
+    size_t size() const;
+
+    // Cherche une position ou sa symétrique (statistiques par nombre de pions),
+    // out.move est ramené à l'orientation de pos
+    bool probe(const Position& pos, Record& out);
+
+    // Mémorise un résultat s'il est plus profond que celui déjà connu
+    void store(const Position& pos, int score, int move, int depth, bool solved);
+
+    // Force l'écriture des résultats en attente
+    void flush();
+
+    // Statistiques par nombre de pions dans la grille (0..CELLS)
+    uint64_t probes(int ply) const { return probes_[ply].load(std::memory_order_relaxed); }
+    uint64_t hits(int ply) const { return hits_[ply].load(std::memory_order_relaxed); }
+    double hitRate(int ply) const;
+    void resetStats();
+
+private:
+    const Record* findSorted(uint64_t key) const;
+    void flushLoop();
+    void writePending(std::unique_lock<std::mutex>& lock);
+
+    // Partie triée du fichier, projetée en mémoire (inchangée jusqu'à close())
+    MappedFile mapped_;
+    const Record* sorted_ = nullptr;
+    size_t sortedCount_ = 0;
+
+    mutable std::mutex mutex_;                  // protège added_, newKeys_, pending_, file_
+    std::condition_variable wake_;
+    std::unordered_map<uint64_t, Record> added_; // résultats de la session (prioritaires sur la partie triée)
+    size_t newKeys_ = 0;                        // clés de added_ absentes de la partie triée
+    std::vector<Record> pending_;               // résultats pas encore écrits
+    std::FILE* file_ = nullptr;
+
+    std::thread writer_;
+    bool stopWriter_ = false;
+
+    std::atomic<uint64_t> probes_[Position::CELLS + 1] = {};
+    std::atomic<uint64_t> hits_[Position::CELLS + 1] = {};
+};
+}
@@ -0,0 +1,239 @@
+#include "Solver.hpp"
+#include "NegamaxEngine.hpp"
+
+namespace SimpleAI
+{
+namespace
+{
+using Bitboard = Position::Bitboard;
+
+// Le temps et le drapeau d'arrêt ne sont vérifiés que toutes les CHECK_INTERVAL positions
+constexpr uint64_t CHECK_INTERVAL = 4096;
+}
+
+Solver::Solver(size_t ttSize)
+    : table_(ttSize)
+{
+}
+
+int Solver::toSearchScore(int score)
+{
+    if (score > 0) return WIN_SCORE + 2 * score - 1;
+    if (score < 0) return -(WIN_SCORE + 2 * -score - 1);
+    return 0;
+}
+
+void Solver::setTimeLimit(std::chrono::milliseconds limit)
+{
+    timeLimit_ = limit;
+}
+
+bool Solver::outOfTime()
+{
+    if (aborted_)
+        return true;
+    if ((nodes_ % CHECK_INTERVAL) != 0)
+        return false;
+
+    if (stop_ && stop_->load(std::memory_order_relaxed))
+        aborted_ = true;
+    else if (timeLimit_.count() > 0 && std::chrono::steady_clock::now() >= deadline_)
+        aborted_ = true;
+
+    return aborted_;
+}
+
+// ---------------------------------------------------------
+// Negamax à fenêtre (alpha, beta) sans limite de profondeur
+// Précondition : le joueur au trait ne peut pas gagner immédiatement
+// ---------------------------------------------------------
+int Solver::negamax(Position& pos, int alpha, int beta)
+{
+    nodes_++;
+    if (outOfTime())
+        return 0;  // résultat ignoré par l'appelant
+
+    const Bitboard next = pos.possibleNonLosingMoves();
+    if (next == 0)
+        return -(Position::CELLS - pos.nbMoves()) / 2;  // l'adversaire gagne au prochain coup
+
+    if (pos.nbMoves() >= Position::CELLS - 2)
+        return 0;  // plus assez de coups pour gagner
+
+    // Bornes naturelles : on ne peut pas perdre avant 2 coups ni gagner avant le prochain
+    int min = -(Position::CELLS - 2 - pos.nbMoves()) / 2;
+    if (alpha < min)
+    {
+        alpha = min;
+        if (alpha >= beta)
+            return alpha;
+    }
+
+    int max = (Position::CELLS - 1 - pos.nbMoves()) / 2;
+
+    // Le score ne dépend pas de l'orientation : une entrée pour la position et sa symétrique
+    bool mirrored = false;
+    const uint64_t key = pos.canonicalKey(mirrored);
+    TranspositionTable::Entry entry;
+    if (table_.get(key, entry))
+    {
+        if (entry.bound == TranspositionTable::Lower)
+        {
+            min = entry.score;
+            if (alpha < min)
+            {
+                alpha = min;
+                if (alpha >= beta)
+                    return alpha;
+            }
+        }
+        else if (entry.bound == TranspositionTable::Upper)
+        {
+            max = entry.score;
+        }
+    }
+
+    if (beta > max)
+    {
+        beta = max;
+        if (alpha >= beta)
+            return beta;
+    }
+
+    // Tri des coups : plus de menaces créées d'abord, centre d'abord à égalité
+    int moves[Position::WIDTH];
+    int priority[Position::WIDTH];
+    int count = 0;
+    for (int col : Position::CENTER_ORDER)
+    {
+        if (!(next & Position::columnMask(col)))
+            continue;
+
+        const int p = pos.threatsAfter(col);
+        int j = count++;
+        while (j > 0 && priority[j - 1] < p)
+        {
+            moves[j] = moves[j - 1];
+            priority[j] = priority[j - 1];
+            j--;
+        }
+        moves[j] = col;
+        priority[j] = p;
+    }
+
+    const int remaining = Position::CELLS - pos.nbMoves();
+    for (int i = 0; i < count; i++)
+    {
+        pos.play(moves[i]);
+        const int score = -negamax(pos, -beta, -alpha);
+        pos.undo(moves[i]);
+        if (aborted_)
+            return 0;
+
+        if (score >= beta)
+        {
+            table_.put(key, score, remaining, TranspositionTable::Lower,
+                       mirrored ? Position::mirrorColumn(moves[i]) : moves[i]);
+            return score;
+        }
+        if (score > alpha)
+            alpha = score;
+    }
+
+    table_.put(key, alpha, remaining, TranspositionTable::Upper, -1);
+    return alpha;
+}
+
+// ---------------------------------------------------------
+// Resserrement itératif des bornes par fenêtres nulles
+// ---------------------------------------------------------
+bool Solver::solveNoReset(const Position& pos, int& score, bool weak)
+{
+    if (pos.canWinNext())
+    {
+        score = (Position::CELLS + 1 - pos.nbMoves()) / 2;
+        return true;
+    }
+
+    int min = -(Position::CELLS - pos.nbMoves()) / 2;
+    int max = (Position::CELLS + 1 - pos.nbMoves()) / 2;
+    if (weak)
+    {
+        min = -1;
+        max = 1;
+    }
+
+    Position work = pos;  // jouée / annulée en place par negamax()
+    while (min < max)
+    {
+        // Fenêtre nulle autour du milieu, rapprochée de 0 pour exploiter les coupures rapides
+        int med = min + (max - min) / 2;
+        if (med <= 0 && min / 2 < med)
+            med = min / 2;
+        else if (med >= 0 && max / 2 > med)
+            med = max / 2;
+
+        const int r = negamax(work, med, med + 1);
+        if (aborted_)
+            return false;
+
+        if (r <= med)
+            max = r;
+        else
+            min = r;
+    }
+
+    score = min;
+    return true;
+}
+
+bool Solver::solve(const Position& pos, int& score, bool weak)
+{
+    nodes_ = 0;
+    aborted_ = false;
+    deadline_ = std::chrono::steady_clock::now() + timeLimit_;
+    return solveNoReset(pos, score, weak);
+}
+
+// ---------------------------------------------------------
+// Score de chaque colonne
+// ---------------------------------------------------------
+bool Solver::analyze(const Position& pos, int scores[Position::WIDTH], int& bestMove, bool weak)
+{
+    nodes_ = 0;
+    aborted_ = false;
+    deadline_ = std::chrono::steady_clock::now() + timeLimit_;
+
+    bestMove = -1;
+    int bestScore = INVALID_MOVE;
+
+    for (int col : Position::CENTER_ORDER)
+    {
+        scores[col] = INVALID_MOVE;
+        if (!pos.canPlay(col))
+            continue;
+
+        if (pos.isWinningMove(col))
+        {
+            scores[col] = (Position::CELLS + 1 - pos.nbMoves()) / 2;
+        }
+        else
+        {
+            Position child = pos;
+            child.play(col);
+            int childScore = 0;
+            if (!solveNoReset(child, childScore, weak))
+                return false;
+            scores[col] = -childScore;
+        }
+
+        if (scores[col] > bestScore)
+        {
+            bestScore = scores[col];
+            bestMove = col;
+        }
+    }
+
+    return true;
+}
+}
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include "Position.hpp"
+#include "TranspositionTable.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   SOLVEUR EXACT (jeu parfait)
+// =============================================================
+// Recherche sans limite de profondeur jusqu'à la fin de la partie :
+//   - fenêtre nulle et resserrement itératif des bornes du score
+//   - table de transposition dédiée (bornes haute / basse)
+//   - seuls les coups qui ne perdent pas immédiatement sont explorés
+//     (parade forcée, jamais sous une menace adverse)
+//   - coups triés par nombre de menaces créées puis centre d'abord
+//
+// Score d'une position, du point de vue du joueur au trait :
+//   0 : match nul avec un jeu parfait
+//   > 0 : victoire, d'autant plus grande qu'elle est rapide
+//         ((CELLS + 1 - pions au moment du coup gagnant) / 2)
+//   < 0 : défaite, symétriquement
+class Solver
+{
+public:
+    static constexpr int MIN_SCORE = -(Position::CELLS) / 2 + 3;
+    static constexpr int MAX_SCORE = (Position::CELLS + 1) / 2 - 3;
+    static constexpr int INVALID_MOVE = -1000;
+
+    static constexpr size_t DEFAULT_TT_SIZE = 1 << 22;  // 4M éléments = 64 Mo
+
+    explicit Solver(size_t ttSize = DEFAULT_TT_SIZE);
+
+    // Score exact de la position (weak : seulement le signe, -1 / 0 / +1, beaucoup plus rapide)
+    // Retourne false si la recherche a été interrompue (temps écoulé / arrêt demandé)
+    bool solve(const Position& pos, int& score, bool weak = false);
+
+    // Score exact de chaque colonne (INVALID_MOVE si injouable) et meilleure colonne
+    bool analyze(const Position& pos, int scores[Position::WIDTH], int& bestMove, bool weak = false);
+
+    // Temps maximum des prochains appels (0 = illimité)
+    void setTimeLimit(std::chrono::milliseconds limit);
+
+    // Drapeau d'arrêt partagé (optionnel, non possédé)
+    void setStopFlag(const std::atomic<bool>* stop) { stop_ = stop; }
+
+    // Nombre de positions visitées depuis le dernier solve() / analyze()
+    uint64_t nodes() const { return nodes_; }
+
+    // Vide la table de transposition
+    void reset() { table_.clear(); }
+
+    // Score exact ramené à l'échelle de NegamaxEngine (WIN_SCORE + coups restants pour une victoire)
+    static int toSearchScore(int score);
+
+private:
+    int negamax(Position& pos, int alpha, int beta);  // pos jouée / annulée en place
+    bool solveNoReset(const Position& pos, int& score, bool weak);
+    bool outOfTime();
+
+    TranspositionTable table_;
+    uint64_t nodes_ = 0;
+
+    std::chrono::milliseconds timeLimit_{0};
+    std::chrono::steady_clock::time_point deadline_;
+    const std::atomic<bool>* stop_ = nullptr;
+    bool aborted_ = false;
+};
+}
@@ -55,6 +55,13 @@ void StateMachine::setPlayerColor(PlayerColor newColor)
     std::cout << "Player color changed to " << (newColor == PlayerColor::Red ? "Red" : "Yellow") << std::endl;
 }
 
+void StateMachine::setBoardSize(int rows, int cols)
+{
+    boardRows = rows;
+    boardCols = cols;
+    std::cout << "Board size changed to " << cols << "x" << rows << std::endl;
+}
+
 float StateMachine::getParam1() const { return Param1; }
 float StateMachine::getParam2() const { return Param2; }
 float StateMachine::getParam3() const { return Param3; }
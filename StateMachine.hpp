@@ -31,12 +31,15 @@ public:
     void ChangeState(State newState);
     void setDifficulty(Difficulty newDifficulty);
     void setPlayerColor(PlayerColor newColor);
+    void setBoardSize(int rows, int cols);
 
     State getState() const { return state; }
     Difficulty getDifficulty() const { return difficulty; }
     PlayerColor getPlayerColor() const { return playerColor; }
     int getPlayerColorValue() const { return static_cast<int>(playerColor); }
     int getRobotColorValue() const { return (playerColor == PlayerColor::Red) ? 2 : 1; }
+    int getBoardRows() const { return boardRows; }
+    int getBoardCols() const { return boardCols; }
 
     bool isState(State stateToCompare) const { return state == stateToCompare; }
 
@@ -49,6 +52,10 @@ private:
     Difficulty difficulty;
     PlayerColor playerColor;
 
+    // Taille de la grille : 7 x 6 standard, 8 x 7 ou 9 x 7 (colonnes x lignes)
+    int boardRows = 6;
+    int boardCols = 7;
+
     // Paramètres internes (par ex. profondeur, itérations, etc.)
     float Param1 = 0;
     float Param2 = 0;
@@ -0,0 +1,101 @@
+#include "TorchNetwork.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include <torch/script.h>
+
+namespace SimpleAI
+{
+struct TorchNetwork::Model
+{
+    torch::jit::Module module;
+    std::vector<float> input;   // maxBatch x INPUT_SIZE, alloué une seule fois
+};
+
+TorchNetwork::TorchNetwork(int maxBatch)
+    : maxBatch_(std::max(1, maxBatch))
+{
+}
+
+TorchNetwork::~TorchNetwork() = default;
+
+bool TorchNetwork::load(const std::string& path, std::string* error)
+{
+    try
+    {
+        auto model = std::make_unique<Model>();
+        model->module = torch::jit::load(path, torch::kCPU);
+        model->module.eval();
+        model->input.resize(static_cast<size_t>(maxBatch_) * INPUT_SIZE);
+        model_ = std::move(model);
+        return true;
+    }
+    catch (const c10::Error& e)
+    {
+        if (error)
+            *error = e.what();
+        model_.reset();
+        return false;
+    }
+}
+
+bool TorchNetwork::isLoaded() const
+{
+    return model_ != nullptr;
+}
+
+void TorchNetwork::setThreads(int threads)
+{
+    torch::set_num_threads(std::max(1, threads));
+}
+
+// ---------------------------------------------------------
+// Un passage du réseau pour tout le lot
+// ---------------------------------------------------------
+void TorchNetwork::evaluate(const Position* positions, int count, NetworkOutput* outputs)
+{
+    count = std::min(count, maxBatch_);
+    if (!model_ || count <= 0)
+    {
+        for (int i = 0; i < count; i++)
+            outputs[i] = NetworkOutput();
+        return;
+    }
+
+    float* input = model_->input.data();
+    for (int i = 0; i < count; i++)
+        encode(positions[i], input + static_cast<size_t>(i) * INPUT_SIZE);
+
+    torch::InferenceMode inference;
+    const at::Tensor batch = torch::from_blob(input, {count, PLANES, Position::HEIGHT, Position::WIDTH}, at::kFloat);
+    const auto result = model_->module.forward({batch}).toTuple();
+    const at::Tensor values = result->elements()[0].toTensor().to(at::kFloat).reshape({count}).contiguous();
+    const at::Tensor logits = result->elements()[1].toTensor().to(at::kFloat).reshape({count, Position::WIDTH}).contiguous();
+    const float* v = values.data_ptr<float>();
+    const float* l = logits.data_ptr<float>();
+
+    for (int i = 0; i < count; i++)
+    {
+        NetworkOutput& out = outputs[i];
+        out.value = v[i];
+
+        // Softmax sur les colonnes jouables uniquement
+        const float* row = l + static_cast<size_t>(i) * Position::WIDTH;
+        float maxLogit = -INFINITY;
+        for (int col = 0; col < Position::WIDTH; col++)
+            if (positions[i].canPlay(col))
+                maxLogit = std::max(maxLogit, row[col]);
+
+        float sum = 0.0f;
+        for (int col = 0; col < Position::WIDTH; col++)
+        {
+            out.policy[col] = positions[i].canPlay(col) ? std::exp(row[col] - maxLogit) : 0.0f;
+            sum += out.policy[col];
+        }
+        for (int col = 0; col < Position::WIDTH; col++)
+            out.policy[col] = sum > 0.0f ? out.policy[col] / sum : 0.0f;
+    }
+}
+}
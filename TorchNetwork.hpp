@@ -0,0 +1,44 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include "NeuralNetwork.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   RÉSEAU VALEUR / POLITIQUE EN TORCHSCRIPT (CPU)
+// =============================================================
+// Modèle attendu (Model/connect4_net.torchscript, à côté du modèle de la caméra) :
+//   entrée  : float [N, 2, HEIGHT, WIDTH] (NeuralNetwork::encode)
+//   sorties : tuple (valeur [N] ou [N, 1] dans [-1, 1], logits de politique [N, WIDTH])
+// La politique est normalisée (softmax) sur les seules colonnes jouables.
+// Les en-têtes de libtorch restent dans TorchNetwork.cpp : ce fichier
+// peut être inclus à côté de Qt (macro slots).
+class TorchNetwork : public NeuralNetwork
+{
+public:
+    static constexpr int DEFAULT_BATCH = 256;
+
+    explicit TorchNetwork(int maxBatch = DEFAULT_BATCH);
+    ~TorchNetwork() override;
+
+    TorchNetwork(const TorchNetwork&) = delete;
+    TorchNetwork& operator=(const TorchNetwork&) = delete;
+
+    // Charge le modèle (false si absent ou invalide, error reçoit alors la cause)
+    bool load(const std::string& path, std::string* error = nullptr);
+    bool isLoaded() const;
+
+    int maxBatch() const override { return maxBatch_; }
+    void evaluate(const Position* positions, int count, NetworkOutput* outputs) override;
+
+    // Threads de calcul de libtorch pour tout le processus (1 quand les parties tournent en parallèle)
+    static void setThreads(int threads);
+
+private:
+    struct Model;   // module TorchScript et tampon d'entrée
+    std::unique_ptr<Model> model_;
+    int maxBatch_;
+};
+}
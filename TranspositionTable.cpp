@@ -1,63 +1,145 @@
 #include "TranspositionTable.hpp"
-/*
-TranspositionTable::TranspositionTable()
-{
-	transpositionTable.resize(size);
-}
+#include <algorithm>
 
-TranspositionTable::~TranspositionTable()
+TranspositionTable::TranspositionTable(size_t size)
 {
-		transpositionTable.clear();
+	resize(size);
 }
 
-void TranspositionTable::put(Board board, uint8_t value)
+void TranspositionTable::resize(size_t size)
 {
-	uint64_t key = getKey(board);
-	unsigned int i = index(key);
-	transpositionTable[i].key = key;
-	transpositionTable[i].value = value;
+	size = std::clamp<size_t>(size, BUCKET_ENTRIES, MAX_SIZE);
+	const size_t count = (size + BUCKET_ENTRIES - 1) / BUCKET_ENTRIES;
+	if (buckets && count == bucketCount)
+		return;  // même taille : ni réallocation ni remise à zéro
+
+	bucketCount = count;
+	buckets.reset(new Bucket[bucketCount]);
+	resetStats();
 }
 
-int TranspositionTable::get(Board board)
+void TranspositionTable::clear()
 {
-	uint64_t key = getKey(board);
-	unsigned int i = index(key);
-	if (transpositionTable[i].key == key)
+	for (size_t i = 0; i < bucketCount; i++)
 	{
-		return transpositionTable[i].value;
+		for (Slot& slot : buckets[i].slots)
+		{
+			slot.keyXorData.store(0, std::memory_order_relaxed);
+			slot.data.store(0, std::memory_order_relaxed);
+		}
 	}
-	else
+	resetStats();
+}
+
+void TranspositionTable::put(uint64_t key, int score, int depth, Bound bound, int move)
+{
+	Bucket& bucket = buckets[index(key)];
+	CounterSlot& stats = localCounters();
+	stats.stores.fetch_add(1, std::memory_order_relaxed);
+
+	// Même position, emplacement libre, sinon l'élément le moins profond est remplacé
+	Slot* target = nullptr;
+	Entry targetEntry;
+	for (Slot& slot : bucket.slots)
 	{
-		return 0;
+		const uint64_t data = slot.data.load(std::memory_order_relaxed);
+		const uint64_t slotKey = slot.keyXorData.load(std::memory_order_relaxed) ^ data;
+		const Entry e = unpack(slotKey, data);
+
+		if (e.bound != None && e.key == key)
+		{
+			target = &slot;
+			targetEntry = e;
+			break;
+		}
+		if (!target
+			|| (e.bound == None && targetEntry.bound != None)
+			|| (e.bound != None && targetEntry.bound != None && e.depth < targetEntry.depth))
+		{
+			target = &slot;
+			targetEntry = e;
+		}
 	}
+
+	if (targetEntry.bound != None && targetEntry.key != key)
+		stats.collisions.fetch_add(1, std::memory_order_relaxed);
+
+	const uint64_t data = pack(score, depth, bound, move);
+	target->keyXorData.store(key ^ data, std::memory_order_relaxed);
+	target->data.store(data, std::memory_order_relaxed);
 }
 
-bool TranspositionTable::contains(Board board)
+bool TranspositionTable::get(uint64_t key, Entry& out)
 {
-	uint64_t key = getKey(board);
-	unsigned int i = index(key);
-	if (transpositionTable[i].key == key)
+	CounterSlot& stats = localCounters();
+	stats.probes.fetch_add(1, std::memory_order_relaxed);
+
+	const Bucket& bucket = buckets[index(key)];
+	for (const Slot& slot : bucket.slots)
 	{
+		const uint64_t data = slot.data.load(std::memory_order_relaxed);
+		if ((slot.keyXorData.load(std::memory_order_relaxed) ^ data) != key)
+			continue;
+
+		Entry e = unpack(key, data);
+		if (e.bound == None)
+			continue;
+
+		stats.hits.fetch_add(1, std::memory_order_relaxed);
+		out = e;
 		return true;
 	}
 	return false;
 }
 
-unsigned int TranspositionTable::index(uint64_t key)
+void TranspositionTable::resetStats()
+{
+	for (CounterSlot& c : counters)
+	{
+		c.probes.store(0, std::memory_order_relaxed);
+		c.hits.store(0, std::memory_order_relaxed);
+		c.stores.store(0, std::memory_order_relaxed);
+		c.collisions.store(0, std::memory_order_relaxed);
+	}
+}
+
+size_t TranspositionTable::index(uint64_t key) const
 {
-	return key % transpositionTable.size();
+	// Hachage multiplicatif : les clés de positions voisines sont très proches
+	return static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 17) % bucketCount;
 }
 
-uint64_t TranspositionTable::getKey(Board board)
+TranspositionTable::CounterSlot& TranspositionTable::localCounters()
 {
-	if (board.getMoveNumber() % 2 == 0)
-	{
-		return board.getRobotBitboard();
-	}
-	else
-	{
-		return board.getPlayerBitboard();
-	}
+	// Chaque thread reçoit un emplacement de compteurs à sa première utilisation
+	static std::atomic<size_t> nextSlot{0};
+	thread_local const size_t slot = nextSlot.fetch_add(1, std::memory_order_relaxed) % COUNTER_SLOTS;
+	return counters[slot];
 }
-*/
 
+uint64_t TranspositionTable::sumCounter(std::atomic<uint64_t> CounterSlot::* counter) const
+{
+	uint64_t total = 0;
+	for (const CounterSlot& c : counters)
+		total += (c.*counter).load(std::memory_order_relaxed);
+	return total;
+}
+
+uint64_t TranspositionTable::pack(int score, int depth, Bound bound, int move)
+{
+	const uint16_t s = static_cast<uint16_t>(static_cast<int16_t>(std::clamp(score, -32767, 32767)));
+	const uint8_t d = static_cast<uint8_t>(std::clamp(depth, 0, 127));
+	const uint8_t m = static_cast<uint8_t>(static_cast<int8_t>(move));
+	return uint64_t(s) | (uint64_t(d) << 16) | (uint64_t(bound) << 24) | (uint64_t(m) << 32);
+}
+
+TranspositionTable::Entry TranspositionTable::unpack(uint64_t key, uint64_t data)
+{
+	Entry e;
+	e.key = key;
+	e.score = static_cast<int16_t>(data & 0xFFFF);
+	e.depth = static_cast<int8_t>((data >> 16) & 0xFF);
+	e.bound = static_cast<uint8_t>((data >> 24) & 0xFF);
+	e.move = static_cast<int8_t>((data >> 32) & 0xFF);
+	return e;
+}
@@ -1,69 +1,146 @@
 #pragma once
 
-#include <vector>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 class TranspositionTable
 {
-    /*/// <summary>
-	/// Transposition table element, storing the board in a 56 bit array, and the evaluated value of the board
+public:
+	/// <summary>
+	/// Type de borne associée au score stocké
+	/// </summary>
+	enum Bound : uint8_t
+	{
+		None = 0,   // emplacement vide
+		Exact = 1,  // score exact
+		Lower = 2,  // le score réel est >= score (coupure beta)
+		Upper = 3   // le score réel est <= score (aucun coup n'a dépassé alpha)
+	};
+
+	/// <summary>
+	/// Contenu décodé d'un élément : clé complète de la position, score, profondeur de recherche,
+	/// type de borne et meilleur coup trouvé
 	/// </summary>
 	struct Entry
 	{
-		uint64_t key: 56;
-		uint8_t value;
+		uint64_t key = 0;
+		int16_t score = 0;
+		int8_t depth = 0;
+		uint8_t bound = None;
+		int8_t move = -1;
 	};
 
-public:
+	static constexpr size_t ENTRY_BYTES = 16;         // deux mots de 64 bits par élément
+	static constexpr size_t DEFAULT_SIZE = 1 << 22;   // 4M éléments = 64 Mo
+	static constexpr size_t MAX_SIZE = 80000000;      // 80 000 000 éléments = 1,28 Go
+	static constexpr size_t BUCKET_ENTRIES = 4;
+
 	/// <summary>
-	/// Allocate the memory for storing the values
+	/// Nombre d'éléments d'une table de megabytes Mo
 	/// </summary>
-	TranspositionTable();
+	static constexpr size_t entriesForMegabytes(size_t megabytes) { return (megabytes << 20) / ENTRY_BYTES; }
 
 	/// <summary>
-	/// Free the memory allocated
+	/// Alloue la table pour size éléments (arrondi au multiple de BUCKET_ENTRIES supérieur)
 	/// </summary>
-	~TranspositionTable();
+	explicit TranspositionTable(size_t size = DEFAULT_SIZE);
 
 	/// <summary>
-	/// Store a board and its value in the trasposition table
+	/// Réalloue la table (le contenu et les statistiques sont perdus), sans effet si
+	/// le nombre d'éléments ne change pas. Aucune recherche ne doit utiliser la table pendant l'appel.
 	/// </summary>
-	/// <param name="board">Board evaluated</param>
-	/// <param name="value">Value of the board</param>
-	void put(Board board, uint8_t value);
+	void resize(size_t size);
 
 	/// <summary>
-	/// Get the value associated with a board, stored in the transposition table
+	/// Vide la table et remet les statistiques à zéro
 	/// </summary>
-	/// <param name="board">Board to evaluate</param>
-	/// <returns>Value of the given board</returns>
-	int get(Board board);
+	void clear();
 
-	unsigned long long size = 40000; // 80000000 is the maximum size
-	
 	/// <summary>
-	/// Check if a board is already in the transposition table
+	/// Stocke le résultat de la recherche d'une position.
+	/// Sans verrou : peut être appelé par plusieurs threads de recherche en même temps.
 	/// </summary>
-	/// <param name="board">Board to evaluate</param>
-	/// <returns>True if the board is in the transposition table, False otherwise</returns>
-	bool contains(Board board);
+	/// <param name="key">Clé de la position (Position::key())</param>
+	/// <param name="score">Score du point de vue du joueur au trait</param>
+	/// <param name="depth">Profondeur restante de la recherche</param>
+	/// <param name="bound">Type de borne du score</param>
+	/// <param name="move">Meilleur coup trouvé (-1 si aucun)</param>
+	void put(uint64_t key, int score, int depth, Bound bound, int move);
+
+	/// <summary>
+	/// Cherche une position dans la table (sans verrou)
+	/// </summary>
+	/// <returns>True et l'élément dans out si la position est présente</returns>
+	bool get(uint64_t key, Entry& out);
+
+	/// <summary>
+	/// Nombre d'éléments alloués
+	/// </summary>
+	size_t size() const { return bucketCount * BUCKET_ENTRIES; }
+
+	/// <summary>
+	/// Mémoire occupée par la table, en octets
+	/// </summary>
+	size_t memoryUsage() const { return bucketCount * sizeof(Bucket); }
+
+	// Statistiques (remises à zéro par clear() et resetStats())
+	uint64_t probes() const { return sumCounter(&CounterSlot::probes); }
+	uint64_t hits() const { return sumCounter(&CounterSlot::hits); }
+	uint64_t stores() const { return sumCounter(&CounterSlot::stores); }
+	uint64_t collisions() const { return sumCounter(&CounterSlot::collisions); }  // positions différentes écrasées
+	void resetStats();
 
 private:
-	std::vector<Entry> transpositionTable;
+	/// <summary>
+	/// Élément stocké : data contient score, profondeur, borne et coup, la clé est mémorisée
+	/// xorée avec data. Un élément à moitié écrit par un autre thread ne correspond plus à sa clé
+	/// et est simplement ignoré, d'où l'absence de verrou.
+	/// </summary>
+	struct Slot
+	{
+		std::atomic<uint64_t> keyXorData{0};
+		std::atomic<uint64_t> data{0};
+	};
 
 	/// <summary>
-	/// Get the index of a given key. The key is a board stored in bit array form
+	/// Groupe d'éléments aligné sur une ligne de cache : un sondage ne touche qu'une ligne
 	/// </summary>
-	/// <param name="key"></param>
-	/// <returns>The index of the given key</returns>
-	unsigned int index(uint64_t key);
+	struct alignas(64) Bucket
+	{
+		Slot slots[BUCKET_ENTRIES];
+	};
+	static_assert(sizeof(Slot) == ENTRY_BYTES, "ENTRY_BYTES doit suivre la taille d'un élément");
 
 	/// <summary>
-	/// Get the corresponding key according to a board. If it is the player turn, give the player bitboard,
-	/// if it is the robot turn, give the robot bitboard
+	/// Compteurs répartis sur plusieurs lignes de cache pour que les threads ne se les disputent pas
 	/// </summary>
-	/// <param name="board">Board get the key</param>
-	/// <returns>Bitboard key corresponding to a Board object</returns>
-	uint64_t getKey(Board board);
-*/
-};
+	struct alignas(64) CounterSlot
+	{
+		std::atomic<uint64_t> probes{0};
+		std::atomic<uint64_t> hits{0};
+		std::atomic<uint64_t> stores{0};
+		std::atomic<uint64_t> collisions{0};
+	};
+	static constexpr size_t COUNTER_SLOTS = 16;
 
+	std::unique_ptr<Bucket[]> buckets;
+	size_t bucketCount = 0;
+	CounterSlot counters[COUNTER_SLOTS];
+
+	/// <summary>
+	/// Index du groupe associé à une clé
+	/// </summary>
+	size_t index(uint64_t key) const;
+
+	/// <summary>
+	/// Compteurs du thread appelant
+	/// </summary>
+	CounterSlot& localCounters();
+
+	uint64_t sumCounter(std::atomic<uint64_t> CounterSlot::* counter) const;
+
+	static uint64_t pack(int score, int depth, Bound bound, int move);
+	static Entry unpack(uint64_t key, uint64_t data);
+};
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+#include "Position.hpp"
+
+namespace SimpleAI
+{
+// =============================================================
+//   TABLE DES ALIGNEMENTS GAGNANTS
+// =============================================================
+// Toutes les fenêtres de 4 cases alignées (69 en 7 x 6) et, pour chaque case,
+// les fenêtres qui la contiennent (16 au plus). Calculée à la compilation.
+// Après un coup, seules les fenêtres de la case jouée peuvent être devenues
+// complètes : la victoire se vérifie sans parcourir la grille.
+//
+// Cases numérotées colonne par colonne depuis le bas (col * HEIGHT + row),
+// chaque fenêtre est donnée en masque de bitboard de BasicPosition.
+template <int Rows, int Cols>
+struct WinLines
+{
+    using Position = BasicPosition<Rows, Cols>;
+    using Bitboard = typename Position::Bitboard;
+
+    static constexpr int CELLS = Rows * Cols;
+    static constexpr int COUNT = Rows * (Cols - 3) + (Rows - 3) * Cols + 2 * (Rows - 3) * (Cols - 3);
+    static constexpr int MAX_PER_CELL = 16;   // 4 fenêtres par direction au plus
+
+    static constexpr int cellIndex(int row, int col) { return col * Rows + row; }
+
+    Bitboard masks[COUNT] = {};
+    uint8_t through[CELLS][MAX_PER_CELL] = {};
+    uint8_t throughCount[CELLS] = {};
+
+    constexpr WinLines()
+    {
+        // Directions (colonne, ligne) : horizontale, verticale, diagonales / et '\'
+        constexpr int DC[4] = {1, 0, 1, 1};
+        constexpr int DR[4] = {0, 1, 1, -1};
+
+        int line = 0;
+        for (int d = 0; d < 4; d++)
+        {
+            for (int col = 0; col < Cols; col++)
+            {
+                for (int row = 0; row < Rows; row++)
+                {
+                    const int lastCol = col + 3 * DC[d];
+                    const int lastRow = row + 3 * DR[d];
+                    if (lastCol >= Cols || lastRow < 0 || lastRow >= Rows)
+                        continue;
+
+                    for (int i = 0; i < 4; i++)
+                    {
+                        const int cell = cellIndex(row + i * DR[d], col + i * DC[d]);
+                        masks[line] |= Position::cellMask(row + i * DR[d], col + i * DC[d]);
+                        through[cell][throughCount[cell]++] = static_cast<uint8_t>(line);
+                    }
+                    line++;
+                }
+            }
+        }
+    }
+
+    // Les pions stones (contenant la case (row, col), compté depuis le bas)
+    // complètent-ils une fenêtre passant par cette case ?
+    constexpr bool completes(Bitboard stones, int row, int col) const
+    {
+        const int cell = cellIndex(row, col);
+        for (int i = 0; i < throughCount[cell]; i++)
+        {
+            const Bitboard mask = masks[through[cell][i]];
+            if ((stones & mask) == mask)
+                return true;
+        }
+        return false;
+    }
+};
+
+// Table de chaque taille de grille, une seule instance par programme
+template <int Rows, int Cols>
+inline constexpr WinLines<Rows, Cols> WIN_LINES{};
+
+static_assert(WinLines<6, 7>::COUNT == 69, "69 alignements possibles sur la grille standard");
+}
@@ -0,0 +1,72 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#elif defined(__linux__)
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace SimpleAI
+{
+namespace
+{
+// Abaisse la priorité du thread appelant (sans effet sur les autres plateformes)
+void lowerCurrentThreadPriority()
+{
+#if defined(_WIN32)
+    SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_LOWEST);
+#elif defined(__linux__)
+    // Sous Linux, la priorité "nice" s'applique au thread désigné par son identifiant noyau
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+}
+}
+
+WorkerPool::WorkerPool(int threads, Priority priority)
+{
+    threads = std::max(1, threads);
+    workers_.reserve(threads);
+    for (int i = 0; i < threads; i++)
+        workers_.emplace_back(&WorkerPool::run, this, priority);
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (std::thread& t : workers_)
+        t.join();
+}
+
+// ---------------------------------------------------------
+// Boucle d'un thread : une tâche à la fois jusqu'à l'arrêt
+// ---------------------------------------------------------
+void WorkerPool::run(Priority priority)
+{
+    if (priority == Priority::Low)
+        lowerCurrentThreadPriority();
+
+    for (;;)
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [this]() { return stop_ || !queue_.empty(); });
+            if (queue_.empty())
+                return;  // arrêt demandé et file vide
+            task = std::move(queue_.front());
+            queue_.pop_front();
+        }
+        task();
+    }
+}
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace SimpleAI
+{
+// =============================================================
+//   GROUPE DE THREADS PERMANENTS
+// =============================================================
+// Les threads sont créés une seule fois ; les tâches soumises sont
+// exécutées dans l'ordre d'arrivée par le premier thread libre et leur
+// résultat (ou leur exception) est rendu par un std::future.
+// Aucune création de thread pendant un tour de jeu.
+class WorkerPool
+{
+public:
+    // Priorité des threads du groupe auprès du système
+    enum class Priority
+    {
+        Normal,
+        Low      // calculs d'arrière-plan (indices) : ne prennent que le temps processeur libre
+    };
+
+    explicit WorkerPool(int threads, Priority priority = Priority::Normal);
+
+    // Termine les tâches déjà soumises puis arrête les threads
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    int size() const { return static_cast<int>(workers_.size()); }
+
+    // Ajoute une tâche à la file, le future reçoit sa valeur de retour
+    template <class F>
+    std::future<std::invoke_result_t<std::decay_t<F>>> submit(F&& task)
+    {
+        using Result = std::invoke_result_t<std::decay_t<F>>;
+        auto packaged = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(task));
+        std::future<Result> result = packaged->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.emplace_back([packaged]() { (*packaged)(); });
+        }
+        wake_.notify_one();
+        return result;
+    }
+
+private:
+    void run(Priority priority);
+
+    std::mutex mutex_;                             // protège queue_ / stop_
+    std::condition_variable wake_;
+    std::deque<std::function<void()>> queue_;
+    bool stop_ = false;
+    std::vector<std::thread> workers_;
+};
+}
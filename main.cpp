@@ -55,7 +55,7 @@ int main(int argc, char *argv[])
             qDebug().noquote() << out;
         }
         else if (!hasGrid) {
-            qDebug() << "[GRID] Incomplète — en attente d'une détection complète (6x7).";
+            qDebug() << "[GRID] Incomplète — en attente d'une détection complète (7 x 6).";
         }
     });
     gridPrinter->start();
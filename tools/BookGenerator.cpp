@@ -0,0 +1,78 @@
+// =============================================================
+//   GÉNÉRATEUR DE BIBLIOTHÈQUE D'OUVERTURES (hors ligne)
+// =============================================================
+// Usage : book_generator <fichier> [--ply N] [--depth D] [--threads T]
+//   --ply     nombre de pions maximum des positions mémorisées (8 par défaut)
+//   --depth   recherche heuristique à cette profondeur au lieu du solveur exact
+//             (plus rapide, mais le mode Difficile ignore alors la bibliothèque)
+//   --threads nombre de threads (tous les cœurs par défaut)
+// Par défaut chaque position est résolue par le solveur exact (coups parfaits) : long,
+// de l'ordre de 0,3 s par position de 8 pions et par thread, davantage pour les plus courtes.
+// Le fichier produit se place dans Model/opening_book.bin, à côté du modèle de la caméra.
+
+#include "OpeningBook.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2)
+    {
+        std::fprintf(stderr, "Usage : %s <fichier> [--ply N] [--depth D] [--threads T]\n", argv[0]);
+        return 1;
+    }
+
+    const std::string path = argv[1];
+    int ply = 8;
+    int depth = 0;  // 0 : solveur exact
+    int threads = 0;
+
+    for (int i = 2; i + 1 < argc; i += 2)
+    {
+        if (std::strcmp(argv[i], "--ply") == 0)
+            ply = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--depth") == 0)
+            depth = std::atoi(argv[i + 1]);
+        else if (std::strcmp(argv[i], "--threads") == 0)
+            threads = std::atoi(argv[i + 1]);
+        else
+        {
+            std::fprintf(stderr, "Option inconnue : %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    const bool solve = depth <= 0;
+    if (solve)
+        std::printf("Génération : positions jusqu'à %d pions, résolues exactement\n", ply);
+    else
+        std::printf("Génération : positions jusqu'à %d pions, profondeur %d\n", ply, depth);
+    const auto start = std::chrono::steady_clock::now();
+
+    const bool ok = SimpleAI::OpeningBook::generate(path, ply, depth, solve, threads,
+        [](size_t done, size_t total) {
+            if (done % 1000 == 0 || done == total)
+                std::fprintf(stderr, "\r%zu / %zu positions", done, total);
+        });
+    std::fprintf(stderr, "\n");
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (!ok)
+    {
+        std::fprintf(stderr, "Échec de l'écriture de %s\n", path.c_str());
+        return 1;
+    }
+
+    SimpleAI::OpeningBook book;
+    if (!book.open(path))
+    {
+        std::fprintf(stderr, "Fichier généré illisible : %s\n", path.c_str());
+        return 1;
+    }
+    std::printf("%zu positions écrites dans %s en %.1f s\n", book.size(), path.c_str(), seconds);
+    return 0;
+}
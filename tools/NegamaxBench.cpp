@@ -0,0 +1,406 @@
+// =============================================================
+//   BANC D'ESSAI DU MOTEUR (sans Qt, caméra ni robot)
+// =============================================================
+// Usage : negamax_bench [--depth D] [--threads T] [--board CxL] [--no-ordering] [--no-eval] [--no-pvs]
+//                      [--no-aspiration] [--no-solver] [--mcts-ms M]
+//   --depth       profondeur de la recherche Negamax (12 par défaut)
+//   --threads     threads de recherche (Lazy SMP, 1 par défaut)
+//   --board       taille de la grille : 7x6 (standard, par défaut), 8x7 ou 9x7 (colonnes x lignes) ;
+//                 les scores exacts ne sont vérifiés que sur la grille standard
+//   --no-ordering désactive le tri des coups
+//   --no-eval     évaluation nulle aux feuilles
+//   --no-pvs      fenêtre complète pour tous les coups (sans recherche à fenêtre nulle)
+//   --no-aspiration fenêtre complète à chaque itération
+//   --no-solver   ne vérifie pas les scores exacts des finales
+//   --mcts-ms     durée de la recherche Monte-Carlo mesurée sur la grille vide (200 par défaut, 0 : aucune)
+//
+// Une ligne JSON par position de la suite, puis une ligne de synthèse :
+//   nodes, nps, time_to_depth (ms cumulées à la fin de chaque itération), best, score, pv,
+//   coupures beta (dont au premier coup essayé), sondages et succès de la table de transposition,
+//   forced (coup joué par la passe tactique, sans recherche)
+//   et pour les positions de score connu : solver_score, expected, ok
+// "cancel_ms" : délai entre l'activation de SearchLimits::stop et le retour d'une recherche
+// sans limite sur la grille vide (au-delà de CANCEL_LATENCY_MS, c'est un échec).
+// "mcts_playouts" / "mcts_pps" : playouts de la recherche Monte-Carlo sur la grille vide
+// (même nombre de threads), à comparer entre --threads 1 et --threads T pour le passage à l'échelle.
+// "batch_ms" / "batch_ms_1" : analyse de tous les coups de toutes les positions (analyzeBatch)
+// sur T threads / un seul, "batch_speedup" leur rapport ; un meilleur coup injouable est un échec.
+// "allocations" compte les allocations pendant la recherche (operator new remplacé) :
+// elle doit n'en faire aucune sur un seul thread.
+// Code de retour 1 si un score exact ne correspond pas au score attendu ou si la recherche alloue.
+
+#include "Analysis.hpp"
+#include "Evaluation.hpp"
+#include "MctsEngine.hpp"
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "Solver.hpp"
+#include "TranspositionTable.hpp"
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleAI;
+
+// ---------------------------------------------------------
+// Compteur d'allocations : la recherche ne doit jamais allouer
+// ---------------------------------------------------------
+namespace
+{
+std::atomic<uint64_t> allocations{0};
+}
+
+void* operator new(std::size_t size)
+{
+    allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+constexpr int UNKNOWN = Solver::INVALID_MOVE;
+
+// Délai maximal de l'arrêt coopératif d'une recherche
+constexpr double CANCEL_LATENCY_MS = 50.0;
+
+// Coups en colonnes 1..7 depuis la grille vide ; expected : score exact du solveur (joueur au trait)
+struct BenchPosition
+{
+    const char* name;
+    const char* moves;
+    int expected;
+};
+
+const BenchPosition SUITE[] = {
+    // Ouvertures
+    {"opening-empty",  "",                         UNKNOWN},
+    {"opening-4",      "4",                        UNKNOWN},
+    {"opening-44",     "44",                       UNKNOWN},
+    {"opening-4453",   "4453",                     UNKNOWN},
+    {"opening-32164625", "32164625",               11},
+    // Milieux de partie
+    {"midgame-12a",    "714616554375",             0},
+    {"midgame-12b",    "177764365717",             -12},
+    {"midgame-14a",    "63776373152551",           -3},
+    {"midgame-14b",    "62455751641634",           6},
+    {"midgame-16a",    "3336726454752765",         0},
+    {"midgame-16b",    "2751716376536713",         -3},
+    {"midgame-18",     "534765223272372151",       3},
+    // Finales
+    {"endgame-20",     "24751332621126237664",     1},
+    {"endgame-22",     "2245535352223445171453",   3},
+    {"endgame-24",     "164324435476571547433137", 2},
+    {"endgame-26",     "66213475521375572266156771", 2},
+    {"endgame-34",     "7422341735647741166133573473242566", 1},
+    {"endgame-37",     "2252576253462244111563365343671351441", -1},
+};
+
+// Rejoue la suite de coups (false si un coup est injouable ou termine la partie)
+template <class Position>
+bool buildPosition(const char* moves, Position& pos)
+{
+    for (const char* m = moves; *m; m++)
+    {
+        const int col = *m - '1';
+        if (col < 0 || col >= Position::WIDTH || !pos.canPlay(col) || pos.isWinningMove(col))
+            return false;
+        pos.play(col);
+    }
+    return true;
+}
+
+double elapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// Temps moyen d'un appel à evaluate() sur les positions de la suite (ns)
+template <class Position>
+double evalNanoseconds(const std::vector<Position>& positions)
+{
+    constexpr int ROUNDS = 200000;
+    volatile int sink = 0;
+
+    const auto start = Clock::now();
+    for (int i = 0; i < ROUNDS; i++)
+        sink = sink + evaluate(positions[i % positions.size()]);
+    return elapsedMs(start) * 1e6 / ROUNDS;
+}
+
+// ---------------------------------------------------------
+// Arrêt coopératif : recherche sans limite interrompue par le jeton d'arrêt, retourne le délai (ms)
+// ---------------------------------------------------------
+template <class Position>
+double cancelLatency(int threads, TranspositionTable& tt, const SearchOptions& options, WorkerPool* pool,
+                     SearchResult& result)
+{
+    std::atomic<bool> stop{false};
+    SearchLimits limits;
+    limits.stop = &stop;
+
+    tt.clear();
+    Clock::time_point stoppedAt;
+    std::thread canceller([&]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        stoppedAt = Clock::now();
+        stop = true;
+    });
+    result = searchParallel(Position(), limits, threads, &tt, options, nullptr, pool);
+    const auto returnedAt = Clock::now();
+    canceller.join();
+
+    return std::chrono::duration<double, std::milli>(returnedAt - stoppedAt).count();
+}
+
+// ---------------------------------------------------------
+// Recherche Monte-Carlo de durée fixe sur la grille vide, retourne les playouts par seconde
+// ---------------------------------------------------------
+template <class Position>
+double mctsThroughput(int threads, int ms, WorkerPool* pool, SearchResult& result, uint64_t& searchAllocations)
+{
+    using Engine = BasicMctsEngine<Position::HEIGHT, Position::WIDTH>;
+
+    std::vector<std::unique_ptr<Engine>> engines;
+    std::vector<Engine*> enginePointers;
+    for (int i = 0; i < threads; i++)
+    {
+        engines.push_back(std::make_unique<Engine>(MctsOptions(), i + 1));
+        enginePointers.push_back(engines.back().get());
+    }
+
+    SearchLimits limits;
+    limits.time = std::chrono::milliseconds(ms);
+
+    const uint64_t allocationsBefore = allocations.load();
+    const auto start = Clock::now();
+    result = searchMcts(enginePointers.data(), threads, Position(), limits, nullptr, pool);
+    const double elapsed = elapsedMs(start);
+    searchAllocations = allocations.load() - allocationsBefore;
+
+    return elapsed > 0.0 ? result.nodes * 1000.0 / elapsed : 0.0;
+}
+
+// ---------------------------------------------------------
+// Analyse de tous les coups des positions de la suite, retourne sa durée (ms)
+// ---------------------------------------------------------
+template <class Position>
+double batchAnalysis(const std::vector<Position>& positions, int depth, int threads, TranspositionTable& tt,
+                     WorkerPool* pool, int& failures)
+{
+    SearchLimits limits;
+    limits.maxDepth = depth;
+    std::vector<PositionAnalysis> results(positions.size());
+
+    tt.clear();
+    const auto start = Clock::now();
+    analyzeBatch(positions.data(), positions.size(), limits, results.data(), threads, &tt, pool);
+    const double ms = elapsedMs(start);
+
+    for (size_t i = 0; i < positions.size(); i++)
+    {
+        const int move = results[i].bestMove;
+        if (move < 0 || !positions[i].canPlay(move) || results[i].scores[move] == INVALID_MOVE_SCORE)
+            failures++;
+    }
+    return ms;
+}
+
+// ---------------------------------------------------------
+// Passe la suite sur une taille de grille, retourne false si une position est invalide
+// ---------------------------------------------------------
+template <class Position>
+bool runSuite(int depth, int threads, const SearchOptions& options, bool checkSolver, int mctsMs, int& failures)
+{
+    TranspositionTable tt(TranspositionTable::MAX_SIZE / 8);
+    Solver solver;
+
+    // Threads auxiliaires permanents, comme dans le jeu (aucune création de thread par recherche)
+    WorkerPool helpers(threads - 1);
+    WorkerPool* pool = threads > 1 ? &helpers : nullptr;
+    constexpr bool standard = Position::WIDTH == 7 && Position::HEIGHT == 6;
+    std::vector<Position> positions;
+
+    uint64_t totalNodes = 0;
+    double totalMs = 0.0;
+
+    for (const BenchPosition& bench : SUITE)
+    {
+        Position pos;
+        if (!buildPosition(bench.moves, pos))
+        {
+            std::fprintf(stderr, "Position invalide : %s\n", bench.name);
+            return false;
+        }
+        positions.push_back(pos);
+
+        tt.clear();
+        SearchLimits limits;
+        limits.maxDepth = depth;
+        SearchStats stats;
+
+        const uint64_t allocationsBefore = allocations.load();
+        const auto start = Clock::now();
+        const SearchResult result = searchParallel(pos, limits, threads, &tt, options, &stats, pool);
+        const double ms = elapsedMs(start);
+        const uint64_t searchAllocations = allocations.load() - allocationsBefore;
+
+        // Avec plusieurs threads, la soumission des recherches auxiliaires alloue
+        if (threads <= 1 && searchAllocations > 0)
+            failures++;
+        const uint64_t nodes = result.nodes;
+        const double nps = ms > 0.0 ? nodes * 1000.0 / ms : 0.0;
+
+        std::string timeToDepth;
+        for (int i = 0; i < stats.iterationCount; i++)
+        {
+            char t[32];
+            std::snprintf(t, sizeof(t), "%s%.3f", i > 0 ? "," : "", stats.iterations[i].time.count() / 1000.0);
+            timeToDepth += t;
+        }
+
+        std::string pv;
+        for (int i = 0; i < stats.pvLength; i++)
+            pv += char('1' + stats.pv[i]);
+
+        totalNodes += nodes;
+        totalMs += ms;
+
+        std::printf("{\"name\":\"%s\",\"moves\":\"%s\",\"ply\":%d,\"depth\":%d,\"best\":%d,\"score\":%d,"
+                    "\"pv\":\"%s\",\"nodes\":%llu,\"ms\":%.3f,\"nps\":%.0f,\"time_to_depth\":[%s],"
+                    "\"cutoffs\":%llu,\"first_move_cutoffs\":%llu,\"tt_probes\":%llu,\"tt_hits\":%llu,"
+                    "\"allocations\":%llu,\"forced\":%s",
+                    bench.name, bench.moves, pos.nbMoves(), result.depth, result.move, result.score,
+                    pv.c_str(), static_cast<unsigned long long>(nodes), ms, nps, timeToDepth.c_str(),
+                    static_cast<unsigned long long>(stats.betaCutoffs),
+                    static_cast<unsigned long long>(stats.cutoffsAtMove[0]),
+                    static_cast<unsigned long long>(stats.ttProbes),
+                    static_cast<unsigned long long>(stats.ttHits),
+                    static_cast<unsigned long long>(searchAllocations),
+                    stats.source == SearchSource::Tactic ? "true" : "false");
+
+        if constexpr (standard)
+        {
+            if (checkSolver && bench.expected != UNKNOWN)
+            {
+                solver.reset();
+                int score = 0;
+                const uint64_t solverAllocationsBefore = allocations.load();
+                const auto solveStart = Clock::now();
+                solver.solve(pos, score);
+                const double solveMs = elapsedMs(solveStart);
+                const bool ok = score == bench.expected && allocations.load() == solverAllocationsBefore;
+                if (!ok)
+                    failures++;
+
+                std::printf(",\"solver_score\":%d,\"expected\":%d,\"solver_nodes\":%llu,\"solver_ms\":%.3f,\"ok\":%s",
+                            score, bench.expected, static_cast<unsigned long long>(solver.nodes()), solveMs,
+                            ok ? "true" : "false");
+            }
+        }
+        std::printf("}\n");
+        std::fflush(stdout);
+    }
+
+    SearchResult cancelled;
+    const double cancelMs = cancelLatency<Position>(threads, tt, options, pool, cancelled);
+    if (cancelMs > CANCEL_LATENCY_MS || cancelled.move < 0)
+        failures++;
+
+    // Analyse groupée : même travail sur un thread puis sur tous
+    const double batchMs1 = batchAnalysis(positions, depth, 1, tt, nullptr, failures);
+    const double batchMs = threads > 1 ? batchAnalysis(positions, depth, threads, tt, pool, failures) : batchMs1;
+
+    // Monte-Carlo : aucune allocation après la construction des arbres (sur un seul thread)
+    SearchResult mcts;
+    uint64_t mctsAllocations = 0;
+    const double mctsPps = mctsMs > 0 ? mctsThroughput<Position>(threads, mctsMs, pool, mcts, mctsAllocations) : 0.0;
+    if (mctsMs > 0 && (mcts.move < 0 || (threads <= 1 && mctsAllocations > 0)))
+        failures++;
+
+    std::printf("{\"summary\":{\"board\":\"%dx%d\",\"positions\":%zu,\"depth\":%d,\"threads\":%d,"
+                "\"nodes\":%llu,\"ms\":%.3f,\"nps\":%.0f,\"eval_ns\":%.1f,\"cancel_ms\":%.3f,"
+                "\"batch_ms_1\":%.3f,\"batch_ms\":%.3f,\"batch_speedup\":%.2f,\"mcts_best\":%d,\"mcts_playouts\":%llu,\"mcts_pps\":%.0f,\"failures\":%d}}\n",
+                Position::WIDTH, Position::HEIGHT, positions.size(), depth, threads,
+                static_cast<unsigned long long>(totalNodes), totalMs,
+                totalMs > 0.0 ? totalNodes * 1000.0 / totalMs : 0.0, evalNanoseconds(positions), cancelMs,
+                batchMs1, batchMs, batchMs > 0.0 ? batchMs1 / batchMs : 0.0, mcts.move, static_cast<unsigned long long>(mcts.nodes), mctsPps, failures);
+
+    return true;
+}
+}
+
+int main(int argc, char* argv[])
+{
+    int depth = 12;
+    int threads = 1;
+    bool checkSolver = true;
+    int mctsMs = 200;
+    std::string board = "7x6";
+    SearchOptions options;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--depth") == 0 && i + 1 < argc)
+            depth = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--board") == 0 && i + 1 < argc)
+            board = argv[++i];
+        else if (std::strcmp(argv[i], "--no-ordering") == 0)
+            options.moveOrdering = false;
+        else if (std::strcmp(argv[i], "--no-eval") == 0)
+            options.heuristicEval = false;
+        else if (std::strcmp(argv[i], "--no-pvs") == 0)
+            options.pvs = false;
+        else if (std::strcmp(argv[i], "--no-aspiration") == 0)
+            options.aspiration = false;
+        else if (std::strcmp(argv[i], "--no-solver") == 0)
+            checkSolver = false;
+        else if (std::strcmp(argv[i], "--mcts-ms") == 0 && i + 1 < argc)
+            mctsMs = std::atoi(argv[++i]);
+        else
+        {
+            std::fprintf(stderr, "Usage : %s [--depth D] [--threads T] [--board 7x6|8x7|9x7] [--no-ordering] "
+                         "[--no-eval] [--no-pvs] [--no-aspiration] [--no-solver] [--mcts-ms M]\n", argv[0]);
+            return 1;
+        }
+    }
+
+    // Une seule instanciation de la recherche par taille de grille
+    int failures = 0;
+    bool valid = false;
+    if (board == "7x6")
+        valid = runSuite<Position>(depth, threads, options, checkSolver, mctsMs, failures);
+    else if (board == "8x7")
+        valid = runSuite<Position8x7>(depth, threads, options, checkSolver, mctsMs, failures);
+    else if (board == "9x7")
+        valid = runSuite<Position9x7>(depth, threads, options, checkSolver, mctsMs, failures);
+    else
+        std::fprintf(stderr, "Grille inconnue : %s (7x6, 8x7 ou 9x7)\n", board.c_str());
+
+    return valid && failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,281 @@
+// =============================================================
+//   BANC D'ESSAI DU RÉSEAU VALEUR / POLITIQUE (libtorch, sans Qt)
+// =============================================================
+// Usage : neural_bench [--model FICHIER] [--positions N] [--batch B] [--games G] [--ms M]
+//   --model      modèle TorchScript (Model/connect4_net.torchscript par défaut)
+//   --positions  positions de la mesure de débit (4096 par défaut)
+//   --batch      taille maximale des lots (256 par défaut)
+//   --games      parties de chaque match de force (20 par défaut, 0 : aucun match)
+//   --ms         temps de réflexion par coup des matchs, identique pour les deux joueurs (100 par défaut)
+//
+// Débit : les mêmes positions évaluées position par position puis par lots de 16, 64, ...
+// jusqu'à --batch ; une ligne JSON par taille de lot (positions/s, µs par position).
+// Force à temps égal : deux matchs contre Negamax seul, ouvertures aléatoires
+// par paires (couleurs inversées) :
+//   "priors" : Negamax trié par la politique du réseau (comme dans le jeu)
+//   "neural" : recherche à pleine largeur avec le réseau aux feuilles (searchNeural)
+// Ligne de synthèse : batch_speedup (débit du plus grand lot / débit position par position)
+// et victoires / nuls / défaites de chaque match, du point de vue du réseau.
+// Code de retour 1 si le modèle ne se charge pas ou si un moteur joue un coup injouable.
+//
+// Jusqu'ici l'outil n'a tourné qu'avec un faux réseau (évaluation heuristique à la place de
+// libtorch) : chaînes de lots et matchs vérifiés, mais aucun débit ni résultat de match
+// d'un vrai modèle n'a encore été mesuré.
+
+#include "MovePriors.hpp"
+#include "NegamaxEngine.hpp"
+#include "NeuralSearch.hpp"
+#include "Position.hpp"
+#include "TorchNetwork.hpp"
+#include "TranspositionTable.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <string>
+#include <vector>
+
+using namespace SimpleAI;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Coups tirés au hasard au début de chaque partie des matchs
+constexpr int RANDOM_PLIES = 4;
+
+// Générateur xorshift64* : positions et ouvertures reproductibles
+uint64_t nextRandom(uint64_t& state)
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+// Joue plies coups sûrs au hasard (moins si la partie se bloque)
+Position randomPosition(int plies, uint64_t& rng)
+{
+    Position pos;
+    for (int i = 0; i < plies; i++)
+    {
+        const Position::Bitboard moves = pos.possibleNonLosingMoves();
+        int columns[Position::WIDTH];
+        int count = 0;
+        for (int col = 0; col < Position::WIDTH; col++)
+            if ((moves & Position::columnMask(col)) && !pos.isWinningMove(col))
+                columns[count++] = col;
+        if (count == 0)
+            break;
+        pos.play(columns[nextRandom(rng) % count]);
+    }
+    return pos;
+}
+
+double elapsedMs(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+// ---------------------------------------------------------
+// Débit : toutes les positions par lots de batch, retourne les positions par seconde
+// ---------------------------------------------------------
+double throughput(NeuralNetwork& net, const std::vector<Position>& positions, int batch)
+{
+    std::vector<NetworkOutput> outputs(positions.size());
+    const auto start = Clock::now();
+    for (size_t first = 0; first < positions.size(); first += batch)
+    {
+        const int count = static_cast<int>(std::min<size_t>(batch, positions.size() - first));
+        net.evaluate(positions.data() + first, count, outputs.data() + first);
+    }
+    const double ms = elapsedMs(start);
+    return ms > 0.0 ? positions.size() * 1000.0 / ms : 0.0;
+}
+
+// Résultat d'un match, du point de vue du premier joueur
+struct MatchResult
+{
+    int wins = 0;
+    int draws = 0;
+    int losses = 0;
+    int illegal = 0;
+    double thinkMs[2] = {};
+    int moves[2] = {};
+};
+
+using Player = std::function<int(const Position&)>;
+
+// ---------------------------------------------------------
+// Match : parties par paires (même ouverture, couleurs inversées)
+// ---------------------------------------------------------
+MatchResult playMatch(const Player& first, const Player& second, int games, uint64_t seed)
+{
+    MatchResult match;
+    const Player* players[2] = {&first, &second};
+
+    for (int game = 0; game < games; game++)
+    {
+        uint64_t rng = seed + static_cast<uint64_t>(game / 2) * 0x9E3779B97F4A7C15ull;
+        nextRandom(rng);
+        Position pos = randomPosition(RANDOM_PLIES, rng);
+
+        int side = (game % 2) ^ (pos.nbMoves() & 1);
+        int result = 0;
+        while (pos.nbMoves() < Position::CELLS)
+        {
+            const auto start = Clock::now();
+            const int col = (*players[side])(pos);
+            match.thinkMs[side] += elapsedMs(start);
+            match.moves[side]++;
+
+            if (col < 0 || col >= Position::WIDTH || !pos.canPlay(col))
+            {
+                match.illegal++;
+                result = side == 0 ? -1 : 1;
+                break;
+            }
+            if (pos.isWinningMove(col))
+            {
+                result = side == 0 ? 1 : -1;
+                break;
+            }
+            pos.play(col);
+            side ^= 1;
+        }
+
+        if (result > 0)
+            match.wins++;
+        else if (result < 0)
+            match.losses++;
+        else
+            match.draws++;
+    }
+    return match;
+}
+
+void printMatch(const char* name, const MatchResult& m)
+{
+    std::printf("{\"match\":\"%s\",\"wins\":%d,\"draws\":%d,\"losses\":%d,\"illegal\":%d,"
+                "\"think_ms_network\":%.3f,\"think_ms_negamax\":%.3f}\n",
+                name, m.wins, m.draws, m.losses, m.illegal,
+                m.moves[0] > 0 ? m.thinkMs[0] / m.moves[0] : 0.0,
+                m.moves[1] > 0 ? m.thinkMs[1] / m.moves[1] : 0.0);
+    std::fflush(stdout);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    std::string model = "Model/connect4_net.torchscript";
+    int positionCount = 4096;
+    int maxBatch = TorchNetwork::DEFAULT_BATCH;
+    int games = 20;
+    int ms = 100;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--model") == 0 && i + 1 < argc)
+            model = argv[++i];
+        else if (std::strcmp(argv[i], "--positions") == 0 && i + 1 < argc)
+            positionCount = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--batch") == 0 && i + 1 < argc)
+            maxBatch = std::max(1, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            games = std::max(0, std::atoi(argv[++i]));
+        else if (std::strcmp(argv[i], "--ms") == 0 && i + 1 < argc)
+            ms = std::max(1, std::atoi(argv[++i]));
+        else
+        {
+            std::fprintf(stderr, "Usage : %s [--model FICHIER] [--positions N] [--batch B] [--games G] [--ms M]\n",
+                         argv[0]);
+            return 1;
+        }
+    }
+
+    // Un seul thread de calcul : le gain mesuré est celui du regroupement, pas du parallélisme
+    TorchNetwork::setThreads(1);
+    TorchNetwork net(maxBatch);
+    std::string error;
+    if (!net.load(model, &error))
+    {
+        std::fprintf(stderr, "Modèle illisible : %s\n%s\n", model.c_str(), error.c_str());
+        return 1;
+    }
+
+    // Positions de milieu de partie variées (0 à 30 pions)
+    uint64_t rng = 1;
+    std::vector<Position> positions;
+    for (int i = 0; i < positionCount; i++)
+        positions.push_back(randomPosition(static_cast<int>(nextRandom(rng) % 31), rng));
+
+    // Lots de 1, 16, 64... jusqu'à maxBatch (compris)
+    std::vector<int> batches;
+    for (int batch = 16; batch < maxBatch; batch *= 4)
+        batches.push_back(batch);
+    batches.insert(batches.begin(), 1);
+    if (maxBatch > 1)
+        batches.push_back(maxBatch);
+
+    double single = 0.0;
+    double largest = 0.0;
+    for (int batch : batches)
+    {
+        largest = throughput(net, positions, batch);
+        if (batch == 1)
+            single = largest;
+        std::printf("{\"batch\":%d,\"positions\":%d,\"pps\":%.0f,\"us_per_position\":%.2f}\n",
+                    batch, positionCount, largest, largest > 0.0 ? 1e6 / largest : 0.0);
+        std::fflush(stdout);
+    }
+
+    // Force à temps égal contre Negamax seul (même budget par coup, tables vidées à chaque coup)
+    SearchLimits limits;
+    limits.time = std::chrono::milliseconds(ms);
+    TranspositionTable tt(1 << 20);  // 16 Mo : vidée à chaque coup, sur le temps du coup
+    MovePriors priors;
+
+    const Player negamax = [&](const Position& pos) {
+        tt.clear();
+        NegamaxEngine engine(&tt);
+        return engine.search(pos, limits).move;
+    };
+    const Player withPriors = [&](const Position& pos) {
+        // Le temps du réseau est pris sur le budget du coup
+        const auto start = Clock::now();
+        computePriors(net, pos, 3, priors);
+        SearchLimits remaining = limits;
+        remaining.time = std::max(std::chrono::milliseconds(1), limits.time -
+                                  std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start));
+        SearchOptions options;
+        options.priors = &priors;
+        tt.clear();
+        NegamaxEngine engine(&tt, options);
+        return engine.search(pos, remaining).move;
+    };
+    const Player neural = [&](const Position& pos) {
+        return searchNeural(net, pos, limits).move;
+    };
+
+    MatchResult priorsMatch;
+    MatchResult neuralMatch;
+    if (games > 0)
+    {
+        priorsMatch = playMatch(withPriors, negamax, games, 1);
+        printMatch("priors", priorsMatch);
+        neuralMatch = playMatch(neural, negamax, games, 1);
+        printMatch("neural", neuralMatch);
+    }
+
+    std::printf("{\"summary\":{\"positions\":%d,\"max_batch\":%d,\"pps_1\":%.0f,\"pps_batch\":%.0f,"
+                "\"batch_speedup\":%.2f,\"games\":%d,\"ms\":%d,"
+                "\"priors\":[%d,%d,%d],\"neural\":[%d,%d,%d]}}\n",
+                positionCount, maxBatch, single, largest, single > 0.0 ? largest / single : 0.0, games, ms,
+                priorsMatch.wins, priorsMatch.draws, priorsMatch.losses,
+                neuralMatch.wins, neuralMatch.draws, neuralMatch.losses);
+
+    return priorsMatch.illegal + neuralMatch.illegal == 0 ? 0 : 1;
+}
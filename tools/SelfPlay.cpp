@@ -0,0 +1,459 @@
+// =============================================================
+//   TOURNOI ENTRE DEUX RÉGLAGES DU MOTEUR (sans Qt, caméra ni robot)
+// =============================================================
+// Usage : selfplay --a MOTEUR --b MOTEUR [--games N] [--threads T] [--random-plies R] [--seed S]
+//   --a, --b        les deux joueurs : type[:clé=valeur,...] ou préréglage de difficulté
+//                   types  : negamax, mcts, solver (solveur exact puis Negamax), random
+//                   clés   : depth (profondeur max), ms (temps par coup), nodes (positions / playouts),
+//                            eval=0 (évaluation nulle), ordering=0 (sans tri des coups) ;
+//                            sans depth, ms ni nodes : 100 ms par coup
+//                   préréglages (moteurs par défaut du jeu, sans engine.json, et budgets de
+//                   GameLogic::searchBudget) : easy (random), medium (negamax:depth=6,ms=300),
+//                   hard (negamax:ms=1500)
+//                   ex. : --a negamax:depth=8,ms=100 --b mcts:ms=100
+//   --games         nombre de parties (1000 par défaut, arrondi au nombre pair supérieur)
+//   --threads       parties jouées en parallèle (tous les cœurs par défaut), un thread par partie
+//   --random-plies  coups tirés au hasard au début de chaque partie (4 par défaut), parmi
+//                   les coups qui ne perdent pas immédiatement
+//   --seed          graine des ouvertures (1 par défaut)
+//
+// Les parties vont par paires : même ouverture, couleurs inversées.
+// Chaque moteur cherche sur un seul thread, avec sa propre table (vidée à chaque partie).
+// Sortie : une ligne JSON de synthèse, du point de vue de A :
+//   wins / draws / losses, score ((victoires + nuls / 2) / parties), elo (écart estimé),
+//   et pour chaque joueur : coups, temps de réflexion moyen et p95 (ms), positions par seconde.
+// Code de retour 1 si un moteur joue un coup injouable.
+
+#include "MctsEngine.hpp"
+#include "NegamaxEngine.hpp"
+#include "Position.hpp"
+#include "Solver.hpp"
+#include "TranspositionTable.hpp"
+#include "WorkerPool.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SimpleAI;
+
+namespace
+{
+using Clock = std::chrono::steady_clock;
+
+// Table de chaque moteur : une par joueur et par partie en cours
+constexpr size_t PLAYER_TT_SIZE = 1 << 20;
+constexpr size_t SOLVER_TT_SIZE = 1 << 20;
+
+// Temps par coup d'un moteur sans aucune limite
+constexpr std::chrono::milliseconds DEFAULT_MOVE_TIME{100};
+
+enum class EngineType
+{
+    Negamax,
+    Mcts,
+    Solver,
+    Random
+};
+
+// Réglage d'un joueur
+struct EngineConfig
+{
+    EngineType type = EngineType::Negamax;
+    SearchLimits limits;
+    SearchOptions options;
+    std::string name;
+};
+
+// ---------------------------------------------------------
+// Lecture d'un réglage : type[:clé=valeur,...] ou préréglage
+// ---------------------------------------------------------
+bool parseConfig(const std::string& name, EngineConfig& config)
+{
+    config = EngineConfig();
+    config.name = name;
+
+    std::string spec = name;
+    if (name == "easy")
+        spec = "random";
+    else if (name == "medium")
+        spec = "negamax:depth=6,ms=300";
+    else if (name == "hard")
+        spec = "negamax:ms=1500";
+
+    const size_t colon = spec.find(':');
+    const std::string type = spec.substr(0, colon);
+    if (type == "negamax")
+        config.type = EngineType::Negamax;
+    else if (type == "mcts")
+        config.type = EngineType::Mcts;
+    else if (type == "solver")
+        config.type = EngineType::Solver;
+    else if (type == "random")
+        config.type = EngineType::Random;
+    else
+        return false;
+
+    size_t begin = colon == std::string::npos ? spec.size() + 1 : colon + 1;
+    while (begin <= spec.size())
+    {
+        size_t end = spec.find(',', begin);
+        if (end == std::string::npos)
+            end = spec.size();
+        const std::string item = spec.substr(begin, end - begin);
+        const size_t equal = item.find('=');
+        if (equal == std::string::npos)
+            return false;
+
+        const std::string key = item.substr(0, equal);
+        const long long value = std::atoll(item.c_str() + equal + 1);
+        if (key == "depth")
+            config.limits.maxDepth = static_cast<int>(value);
+        else if (key == "ms")
+            config.limits.time = std::chrono::milliseconds(value);
+        else if (key == "nodes")
+            config.limits.nodes = static_cast<uint64_t>(value);
+        else if (key == "eval")
+            config.options.heuristicEval = value != 0;
+        else if (key == "ordering")
+            config.options.moveOrdering = value != 0;
+        else
+            return false;
+        begin = end + 1;
+    }
+
+    // Aucune limite : la recherche ne s'arrêterait qu'en fin de partie
+    if (config.limits.maxDepth == MAX_CELLS && config.limits.time.count() == 0 && config.limits.nodes == 0)
+        config.limits.time = DEFAULT_MOVE_TIME;
+    return true;
+}
+
+// Générateur xorshift64* : une suite reproductible par partie
+uint64_t nextRandom(uint64_t& state)
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * 0x2545F4914F6CDD1Dull;
+}
+
+// Colonne tirée au hasard parmi les coups de moves (une case par colonne)
+int randomColumn(const Position& pos, Position::Bitboard moves, uint64_t& rng)
+{
+    int columns[Position::WIDTH];
+    int count = 0;
+    for (int col = 0; col < Position::WIDTH; col++)
+        if (pos.canPlay(col) && (moves & Position::columnMask(col)))
+            columns[count++] = col;
+    return count > 0 ? columns[nextRandom(rng) % count] : -1;
+}
+
+// ---------------------------------------------------------
+// Joueur : un moteur et ses tables, réutilisés de partie en partie
+// ---------------------------------------------------------
+class Player
+{
+public:
+    explicit Player(const EngineConfig& config)
+        : config_(config)
+    {
+        if (config_.type == EngineType::Negamax || config_.type == EngineType::Solver)
+            tt_ = std::make_unique<TranspositionTable>(PLAYER_TT_SIZE);
+        if (config_.type == EngineType::Solver)
+            solver_ = std::make_unique<Solver>(SOLVER_TT_SIZE);
+        if (config_.type == EngineType::Mcts)
+            mcts_ = std::make_unique<MctsEngine>();
+    }
+
+    // Nouvelle partie : aucun souvenir de la précédente
+    void newGame(uint64_t seed)
+    {
+        rng_ = seed | 1;
+        if (tt_)
+            tt_->clear();
+        if (solver_)
+            solver_->reset();
+        if (mcts_)
+            mcts_->clear();
+    }
+
+    // Coup du joueur au trait, nodes reçoit les positions (ou playouts) visitées
+    int play(const Position& pos, uint64_t& nodes)
+    {
+        nodes = 0;
+        switch (config_.type)
+        {
+        case EngineType::Random:
+            return randomColumn(pos, pos.possible(), rng_);
+
+        case EngineType::Mcts:
+        {
+            const SearchResult result = mcts_->search(pos, config_.limits);
+            nodes = result.nodes;
+            return result.move;
+        }
+
+        case EngineType::Solver:
+        {
+            // Comme SearchMode::Solver : la moitié du budget au solveur, le reste à Negamax
+            const auto start = Clock::now();
+            solver_->setTimeLimit(config_.limits.time / 2);
+            int scores[Position::WIDTH];
+            int move = -1;
+            const bool solved = solver_->analyze(pos, scores, move);
+            nodes = solver_->nodes();
+            if (solved && move >= 0)
+                return move;
+
+            SearchLimits limits = config_.limits;
+            if (limits.time.count() > 0)
+            {
+                const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(Clock::now() - start);
+                limits.time = std::max(std::chrono::milliseconds(1), limits.time - elapsed);
+            }
+            return searchNegamax(pos, limits, nodes);
+        }
+
+        case EngineType::Negamax:
+        default:
+            return searchNegamax(pos, config_.limits, nodes);
+        }
+    }
+
+private:
+    int searchNegamax(const Position& pos, const SearchLimits& limits, uint64_t& nodes)
+    {
+        NegamaxEngine engine(tt_.get(), config_.options);
+        const SearchResult result = engine.search(pos, limits);
+        nodes += result.nodes;
+        return result.move >= 0 ? result.move : Position::WIDTH / 2;
+    }
+
+    EngineConfig config_;
+    std::unique_ptr<TranspositionTable> tt_;
+    std::unique_ptr<Solver> solver_;
+    std::unique_ptr<MctsEngine> mcts_;
+    uint64_t rng_ = 1;
+};
+
+// Mesures d'un joueur sur l'ensemble des parties
+struct PlayerStats
+{
+    std::vector<double> thinkMs;   // temps de chaque coup
+    uint64_t nodes = 0;
+    double searchMs = 0.0;
+
+    void merge(const PlayerStats& other)
+    {
+        thinkMs.insert(thinkMs.end(), other.thinkMs.begin(), other.thinkMs.end());
+        nodes += other.nodes;
+        searchMs += other.searchMs;
+    }
+};
+
+// Résultats d'un thread de jeu
+struct MatchStats
+{
+    int wins = 0;     // du point de vue de A
+    int draws = 0;
+    int losses = 0;
+    int illegal = 0;  // coups injouables (partie perdue par leur auteur)
+    PlayerStats players[2];
+};
+
+// ---------------------------------------------------------
+// Une partie : ouverture aléatoire puis A et B en alternance,
+// retourne +1 si A gagne, -1 si B gagne, 0 si nul
+// ---------------------------------------------------------
+int playGame(Player* players[2], bool aStarts, int randomPlies, uint64_t openingSeed, MatchStats& stats)
+{
+    Position pos;
+
+    // Ouverture : identique pour les deux parties de la paire
+    uint64_t rng = openingSeed;
+    for (int i = 0; i < randomPlies && pos.nbMoves() < Position::CELLS; i++)
+    {
+        Position::Bitboard moves = pos.possibleNonLosingMoves();
+        if (!moves)
+            moves = pos.possible();
+        const int col = randomColumn(pos, moves, rng);
+        if (col < 0 || pos.isWinningMove(col))
+            break;
+        pos.play(col);
+    }
+
+    // Joueur au trait : 0 = A, 1 = B (A commence la partie, pas nécessairement après l'ouverture)
+    int side = (aStarts ? 0 : 1) ^ (pos.nbMoves() & 1);
+    while (pos.nbMoves() < Position::CELLS)
+    {
+        uint64_t nodes = 0;
+        const auto start = Clock::now();
+        const int col = players[side]->play(pos, nodes);
+        const double ms = std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+
+        PlayerStats& player = stats.players[side];
+        player.thinkMs.push_back(ms);
+        player.nodes += nodes;
+        player.searchMs += ms;
+
+        if (col < 0 || col >= Position::WIDTH || !pos.canPlay(col))
+        {
+            stats.illegal++;
+            return side == 0 ? -1 : 1;
+        }
+        if (pos.isWinningMove(col))
+            return side == 0 ? 1 : -1;
+        pos.play(col);
+        side ^= 1;
+    }
+    return 0;
+}
+
+// Parties tirées dans un compteur partagé jusqu'à épuisement
+void playGames(const EngineConfig& a, const EngineConfig& b, int games, int randomPlies, uint64_t seed,
+               std::atomic<int>& next, MatchStats& stats)
+{
+    Player playerA(a);
+    Player playerB(b);
+    Player* players[2] = {&playerA, &playerB};
+
+    for (int game = next++; game < games; game = next++)
+    {
+        // Paire 2k / 2k + 1 : même ouverture, A commence la première
+        uint64_t openingSeed = seed * 0x9E3779B97F4A7C15ull + static_cast<uint64_t>(game / 2) + 1;
+        nextRandom(openingSeed);
+        playerA.newGame(openingSeed ^ 0xA);
+        playerB.newGame(openingSeed ^ 0xB);
+
+        const int result = playGame(players, game % 2 == 0, randomPlies, openingSeed, stats);
+        if (result > 0)
+            stats.wins++;
+        else if (result < 0)
+            stats.losses++;
+        else
+            stats.draws++;
+    }
+}
+
+// Centile p (0..1) des durées, 0 s'il n'y en a aucune
+double percentile(std::vector<double> values, double p)
+{
+    if (values.empty())
+        return 0.0;
+    const size_t index = std::min(values.size() - 1, static_cast<size_t>(p * values.size()));
+    std::nth_element(values.begin(), values.begin() + index, values.end());
+    return values[index];
+}
+
+double mean(const std::vector<double>& values)
+{
+    double sum = 0.0;
+    for (double v : values)
+        sum += v;
+    return values.empty() ? 0.0 : sum / values.size();
+}
+
+void printPlayer(const char* label, const EngineConfig& config, const PlayerStats& stats)
+{
+    std::printf("\"%s\":{\"engine\":\"%s\",\"moves\":%zu,\"think_ms_avg\":%.3f,\"think_ms_p95\":%.3f,"
+                "\"nodes\":%llu,\"nps\":%.0f}",
+                label, config.name.c_str(), stats.thinkMs.size(), mean(stats.thinkMs),
+                percentile(stats.thinkMs, 0.95), static_cast<unsigned long long>(stats.nodes),
+                stats.searchMs > 0.0 ? stats.nodes * 1000.0 / stats.searchMs : 0.0);
+}
+}
+
+int main(int argc, char* argv[])
+{
+    std::string specA;
+    std::string specB;
+    int games = 1000;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    int randomPlies = 4;
+    uint64_t seed = 1;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if (std::strcmp(argv[i], "--a") == 0 && i + 1 < argc)
+            specA = argv[++i];
+        else if (std::strcmp(argv[i], "--b") == 0 && i + 1 < argc)
+            specB = argv[++i];
+        else if (std::strcmp(argv[i], "--games") == 0 && i + 1 < argc)
+            games = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc)
+            threads = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--random-plies") == 0 && i + 1 < argc)
+            randomPlies = std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc)
+            seed = std::strtoull(argv[++i], nullptr, 10);
+        else
+        {
+            specA.clear();
+            break;
+        }
+    }
+
+    EngineConfig a;
+    EngineConfig b;
+    if (specA.empty() || specB.empty() || !parseConfig(specA, a) || !parseConfig(specB, b))
+    {
+        std::fprintf(stderr, "Usage : %s --a MOTEUR --b MOTEUR [--games N] [--threads T] [--random-plies R] "
+                     "[--seed S]\n  MOTEUR : negamax|mcts|solver|random[:depth=D,ms=M,nodes=N,eval=0|1,ordering=0|1]"
+                     " ou easy|medium|hard\n", argv[0]);
+        return 1;
+    }
+
+    games = std::max(2, games + (games & 1));
+    threads = std::max(1, std::min(threads, games));
+
+    // Un thread par partie en cours, chacun avec ses deux joueurs
+    std::atomic<int> next{0};
+    std::vector<MatchStats> results(threads);
+    const auto start = Clock::now();
+    {
+        WorkerPool pool(threads);
+        std::vector<std::future<void>> done;
+        for (int t = 0; t < threads; t++)
+            done.push_back(pool.submit([&, t]() { playGames(a, b, games, randomPlies, seed, next, results[t]); }));
+
+        for (std::future<void>& f : done)
+            while (f.wait_for(std::chrono::milliseconds(500)) != std::future_status::ready)
+                std::fprintf(stderr, "\r%d / %d parties", std::min(next.load(), games), games);
+        std::fprintf(stderr, "\r%d / %d parties\n", games, games);
+    }
+    const double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+
+    MatchStats total;
+    for (const MatchStats& r : results)
+    {
+        total.wins += r.wins;
+        total.draws += r.draws;
+        total.losses += r.losses;
+        total.illegal += r.illegal;
+        total.players[0].merge(r.players[0]);
+        total.players[1].merge(r.players[1]);
+    }
+
+    const double score = (total.wins + 0.5 * total.draws) / games;
+    const double elo = score <= 0.0 ? -999.0 : score >= 1.0 ? 999.0 : -400.0 * std::log10(1.0 / score - 1.0);
+
+    std::printf("{\"summary\":{\"games\":%d,\"threads\":%d,\"random_plies\":%d,\"seed\":%llu,\"seconds\":%.1f,"
+                "\"wins\":%d,\"draws\":%d,\"losses\":%d,\"illegal\":%d,\"score\":%.3f,\"elo\":%.0f,",
+                games, threads, randomPlies, static_cast<unsigned long long>(seed), seconds,
+                total.wins, total.draws, total.losses, total.illegal, score, elo);
+    printPlayer("a", a, total.players[0]);
+    std::printf(",");
+    printPlayer("b", b, total.players[1]);
+    std::printf("}}\n");
+
+    return total.illegal == 0 ? 0 : 1;
+}